@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+"""
+Analysis script of the streamed back-transformed diagnostics.
+
+diag3 writes every buffer of the lab-frame snapshots as its own step, with the
+layout used with ADIOS2 SST. The snapshots are assembled from these steps with
+Tools/PostProcessing/btd_stream_consumer.py and compared with those written
+directly by diag2: the fields and the particles must be the same.
+"""
+
+import glob
+
+import numpy as np
+import openpmd_api as io
+from btd_stream_consumer import consume
+
+stream = glob.glob("./diags/diag3/openpmd.bp*")
+assert len(stream) == 1, f"stream file not found: {stream}"
+consume(stream[0], "./diags/diag3_lab/openpmd_%T.bp5")
+
+series = io.Series("./diags/diag2/openpmd_%T.bp5", io.Access.read_only)
+series_stream = io.Series("./diags/diag3_lab/openpmd_%T.bp5", io.Access.read_only)
+
+iterations = list(series.iterations)
+assert iterations == list(series_stream.iterations), (
+    f"snapshots {iterations} != {list(series_stream.iterations)}"
+)
+
+for i in iterations:
+    it = series.iterations[i]
+    it_stream = series_stream.iterations[i]
+
+    # fields
+    for mesh_name, mesh in it.meshes.items():
+        for comp_name, rc in mesh.items():
+            rc_stream = it_stream.meshes[mesh_name][comp_name]
+            assert rc.shape == rc_stream.shape, f"{mesh_name}/{comp_name}"
+            data = rc.load_chunk()
+            data_stream = rc_stream.load_chunk()
+            series.flush()
+            series_stream.flush()
+            assert np.array_equal(data, data_stream), (
+                f"snapshot {i}: {mesh_name}/{comp_name} differs"
+            )
+
+    # particles: the buffers are concatenated in the order in which they are
+    # flushed, so that the particles are compared after sorting by id
+    for species_name, species in it.particles.items():
+        num_particles = species["id"][io.Record_Component.SCALAR].shape[0]
+        if num_particles == 0:
+            continue
+        species_stream = it_stream.particles[species_name]
+        ids = species["id"][io.Record_Component.SCALAR].load_chunk()
+        ids_stream = species_stream["id"][io.Record_Component.SCALAR].load_chunk()
+        series.flush()
+        series_stream.flush()
+        order = np.argsort(ids)
+        order_stream = np.argsort(ids_stream)
+        assert np.array_equal(ids[order], ids_stream[order_stream]), (
+            f"snapshot {i}: {species_name} ids differ"
+        )
+        for record_name in ["position", "momentum", "weighting"]:
+            for comp_name, rc in species[record_name].items():
+                rc_stream = species_stream[record_name][comp_name]
+                data = rc.load_chunk()
+                data_stream = rc_stream.load_chunk()
+                series.flush()
+                series_stream.flush()
+                assert np.array_equal(data[order], data_stream[order_stream]), (
+                    f"snapshot {i}: {species_name}/{record_name}/{comp_name} differs"
+                )
+    print(f"snapshot {i}: streamed and direct lab-frame data agree")
+
+series.close()
+series_stream.close()
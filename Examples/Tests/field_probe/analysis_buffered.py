@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+"""
+This script checks the output of a FieldProbe that buffers its samples
+(buffer_steps) and optionally averages them (decimation), against the output
+of the same probe without buffering nor averaging.
+
+Usage: analysis_buffered.py <file> <reference file> <decimation>
+"""
+
+import sys
+
+import numpy as np
+import pandas as pd
+
+filename = sys.argv[1]
+ref_filename = sys.argv[2]
+decimation = int(sys.argv[3])
+
+df = pd.read_csv(filename, sep=" ")
+df_ref = pd.read_csv(ref_filename, sep=" ")
+step_col = "[0]step()"
+
+# the reference writes a sample every output step, at all the steps of the run
+ref_steps = np.unique(df_ref[step_col].to_numpy())
+assert len(ref_steps) > 0
+
+if decimation == 1:
+    # buffering must not change the output, and all the samples must be written
+    # even though the last buffer is not full at the end of the run
+    assert df.shape == df_ref.shape, f"{df.shape} != {df_ref.shape}"
+    assert np.array_equal(df.to_numpy(), df_ref.to_numpy())
+else:
+    # each written sample is the average of the decimation previous output steps,
+    # and is written at the last of these steps
+    expected_steps = ref_steps[decimation - 1 :: decimation]
+    steps = np.unique(df[step_col].to_numpy())
+    assert np.array_equal(steps, expected_steps), f"{steps} != {expected_steps}"
+
+    field_cols = [c for c in df.columns if "part_E" in c or "part_B" in c or "part_S" in c]
+    for i_sample, step in enumerate(expected_steps):
+        sample = df[df[step_col] == step]
+        averaged_steps = ref_steps[i_sample * decimation : (i_sample + 1) * decimation]
+        ref_samples = [df_ref[df_ref[step_col] == s] for s in averaged_steps]
+        for col in df.columns:
+            if col == step_col:
+                continue
+            values = sample[col].to_numpy()
+            if col in field_cols:
+                expected = np.mean([r[col].to_numpy() for r in ref_samples], axis=0)
+                atol = 1e-12 * np.max(np.abs(df_ref[col].to_numpy()))
+                assert np.allclose(values, expected, rtol=1e-12, atol=atol), (
+                    f"{col} at step {step}"
+                )
+            else:
+                # time and positions of the last averaged step
+                assert np.array_equal(values, ref_samples[-1][col].to_numpy()), (
+                    f"{col} at step {step}"
+                )
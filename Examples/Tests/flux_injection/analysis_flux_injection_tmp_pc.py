@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+#
+# This script checks that the flux injection through a temporary container
+# (<species>.flux_injection_in_place = 0) gives the same particles as the
+# injection in place of the 3D flux injection test. The particles are the same,
+# but may be stored in a different order, so the sums of their attributes are
+# compared up to round-off errors.
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+# plotfile of the run with the temporary container, and plotfile of the reference run
+fn_tmp_pc = sys.argv[1]
+fn_ref = sys.argv[2]
+
+ad_tmp_pc = yt.load(fn_tmp_pc).all_data()
+ad_ref = yt.load(fn_ref).all_data()
+
+for species in ["electron", "proton", "electron_negative", "proton_negative"]:
+    w_tmp_pc = ad_tmp_pc[species, "particle_weight"].v
+    w_ref = ad_ref[species, "particle_weight"].v
+    print(f"{species}: {w_tmp_pc.size} particles, reference: {w_ref.size}")
+    assert w_tmp_pc.size == w_ref.size
+
+    for attribute in [
+        "particle_weight",
+        "particle_position_x",
+        "particle_position_y",
+        "particle_position_z",
+        "particle_momentum_x",
+        "particle_momentum_y",
+        "particle_momentum_z",
+    ]:
+        values_ref = ad_ref[species, attribute].v
+        sum_tmp_pc = np.sum(ad_tmp_pc[species, attribute].v)
+        sum_ref = np.sum(values_ref)
+        print(f"  {attribute}: sum = {sum_tmp_pc}, reference: {sum_ref}")
+        # The sums of the positions and momenta can be close to zero, so the
+        # round-off errors are bounded relative to the sum of the absolute values
+        assert abs(sum_tmp_pc - sum_ref) <= 1e-12 * np.sum(np.abs(values_ref))
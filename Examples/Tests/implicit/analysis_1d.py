@@ -25,6 +25,26 @@ max_delta_E = np.abs(delta_E).max()
 test_name = os.path.split(os.getcwd())[1]
 if re.match("test_1d_semi_implicit_picard", test_name):
     tolerance_rel = 2.5e-5
+elif re.match("test_1d_theta_implicit_picard_anderson", test_name):
+    # This case is converged to the relative tolerance of the Picard solver
+    tolerance_rel = 1.0e-11
+    # Anderson mixing must converge before the maximum number of iterations
+    picard_iters = np.loadtxt("diags/reducedfiles/picard.txt", usecols=2, ndmin=1)
+    print(f"max Picard iterations: {picard_iters.max()}")
+    assert picard_iters.max() < 31
+elif re.match("test_1d_theta_implicit_picard_tolerance", test_name):
+    # This case is converged to the same relative tolerance as the Anderson case
+    tolerance_rel = 1.0e-11
+    # Anderson mixing must need fewer iterations than plain Picard on the same input
+    picard_iters = np.loadtxt("diags/reducedfiles/picard.txt", usecols=2, ndmin=1)
+    anderson_iters = np.loadtxt(
+        "../test_1d_theta_implicit_picard_anderson/diags/reducedfiles/picard.txt",
+        usecols=2,
+        ndmin=1,
+    )
+    print(f"total Picard iterations: {picard_iters.sum()}")
+    print(f"total Picard iterations with Anderson mixing: {anderson_iters.sum()}")
+    assert anderson_iters.sum() < picard_iters.sum()
 elif re.match("test_1d_theta_implicit_picard", test_name):
     # This case should have near machine precision conservation of energy
     tolerance_rel = 1.0e-14
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+#
+# This script compares the test `inputs_test_2d_theta_implicit_jfnk_vandb`,
+# run with the mass matrices in the Jacobian or in the preconditioner, with
+# the same test run with the default JFNK solver. The Newton solver converges
+# to the same solution, so that the fields must agree up to the Newton
+# tolerance. In addition:
+# - with the mass matrices in the Jacobian (approximate Jacobian), the Newton
+#   solver must still converge to its tolerance at every step;
+# - with the mass matrices in the preconditioner, the Newton iterations must
+#   be the same and GMRES must need fewer iterations in total.
+#
+# Usage: analysis_mass_matrices.py <jacobian|pc> <plotfile> <reference plotfile>
+#            <Newton diagnostic file> <reference Newton diagnostic file>
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+mode = sys.argv[1]
+assert mode in ["jacobian", "pc"]
+filename = sys.argv[2]
+ref_filename = sys.argv[3]
+
+# Newton solver: columns step, time, iters, norm_abs, norm_rel, gmres_iters, gmres_last_res
+history = np.loadtxt(sys.argv[4], ndmin=2)
+history_ref = np.loadtxt(sys.argv[5], ndmin=2)
+assert np.array_equal(history[:, 0], history_ref[:, 0])
+
+newton_iters = history[:, 2]
+newton_iters_ref = history_ref[:, 2]
+gmres_iters = history[:, 5]
+gmres_iters_ref = history_ref[:, 5]
+print(f"Newton iterations: {newton_iters} (default: {newton_iters_ref})")
+print(f"GMRES iterations: {gmres_iters} (default: {gmres_iters_ref})")
+
+if mode == "jacobian":
+    # relative tolerance of the Newton solver in the input file
+    newton_rtol = 1.0e-12
+    print(f"max relative Newton residual: {history[:, 4].max()}")
+    assert np.all(history[:, 4] < newton_rtol)
+else:
+    assert np.all(np.abs(newton_iters - newton_iters_ref) <= 1)
+    assert gmres_iters.sum() < gmres_iters_ref.sum()
+
+
+def read_level0(fn, field):
+    ds = yt.load(fn)
+    grid = ds.covering_grid(
+        level=0, left_edge=ds.domain_left_edge, dims=ds.domain_dimensions
+    )
+    return grid[("boxlib", field)].to_ndarray()
+
+
+# The two runs converge to the Newton tolerance (1e-12), with GMRES tolerance
+# 1e-8 at each Newton iteration
+tolerance = 1.0e-8
+for field in ["Ex", "Ey", "Ez", "Bx", "By", "Bz", "jx", "jy", "jz"]:
+    f = read_level0(filename, field)
+    f_ref = read_level0(ref_filename, field)
+    error = np.max(np.abs(f - f_ref)) / np.max(np.abs(f_ref))
+    print(f"{field}: relative difference {error:.3e} (tolerance {tolerance:.1e})")
+    assert error < tolerance
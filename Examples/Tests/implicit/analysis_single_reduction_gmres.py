@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+#
+# This script compares the convergence history of the Newton solver when the
+# linear systems are solved with SingleReduceGMRES (gmres.single_reduction = 1)
+# to that obtained with amrex::GMRES (modified Gram-Schmidt) on the same input.
+# Both solvers build the same Krylov spaces: the number of Newton and GMRES
+# iterations must match (up to one GMRES iteration when a residual is close to
+# the tolerance), and the Newton residuals must reach the same level.
+import sys
+
+import numpy as np
+
+# columns: step, time, iters, norm_abs, norm_rel, gmres_iters, gmres_last_res
+history = np.loadtxt(sys.argv[1], ndmin=2)
+history_ref = np.loadtxt(sys.argv[2], ndmin=2)
+
+assert history.shape == history_ref.shape
+assert np.array_equal(history[:, 0], history_ref[:, 0])
+
+newton_iters = history[:, 2]
+newton_iters_ref = history_ref[:, 2]
+gmres_iters = history[:, 5]
+gmres_iters_ref = history_ref[:, 5]
+print(f"Newton iterations: {newton_iters} (amrex::GMRES: {newton_iters_ref})")
+print(f"GMRES iterations: {gmres_iters} (amrex::GMRES: {gmres_iters_ref})")
+
+assert np.array_equal(newton_iters, newton_iters_ref)
+assert np.all(np.abs(gmres_iters - gmres_iters_ref) <= 1)
+
+# relative tolerance of the Newton solver in the input file
+newton_rtol = 1.0e-12
+norm_rel = history[:, 4]
+norm_rel_ref = history_ref[:, 4]
+print(f"max relative Newton residual: {norm_rel.max()} (amrex::GMRES: {norm_rel_ref.max()})")
+
+assert np.all(norm_rel <= np.maximum(10.0 * norm_rel_ref, newton_rtol))
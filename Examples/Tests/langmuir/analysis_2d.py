@@ -41,6 +41,9 @@ vay_deposition = True if re.search("vay_deposition", test_name) else False
 # Parse test name and check if particle_shape = 4 is used
 particle_shape_4 = True if re.search("particle_shape_4", test_name) else False
 
+# Parse test name and check if Esirkepov current deposition (algo.current_deposition=esirkepov) is used
+esirkepov = True if re.search("esirkepov", test_name) else False
+
 # Parameters (must match the parameters in the inputs)
 # FIXME read these parameters from warpx_used_inputs
 epsilon = 0.01
@@ -145,11 +148,20 @@ assert error_rel < tolerance_rel
 
 # Check relative L-infinity spatial norm of rho/epsilon_0 - div(E)
 # with current correction (and periodic single box option) or with Vay current deposition
+# or with Esirkepov current deposition and the FDTD solver
 if current_correction:
     tolerance = 1e-9
 elif vay_deposition:
     tolerance = 1e-3
-if current_correction or vay_deposition:
+elif esirkepov:
+    # Charge is conserved up to round-off errors, also in single precision,
+    # where the current is accumulated in double precision on CPU:
+    # the precision of the plotfile data is read from the header of its first FAB
+    with open(os.path.join(fn, "Level_0", "Cell_D_00000"), "rb") as f:
+        fab_header = f.readline().decode()
+    real_type = np.float32 if fab_header.startswith("FAB ((4,") else np.float64
+    tolerance = 1e4 * np.finfo(real_type).eps
+if current_correction or vay_deposition or esirkepov:
     rho = data[("boxlib", "rho")].to_ndarray()
     divE = data[("boxlib", "divE")].to_ndarray()
     error_rel = np.amax(np.abs(divE - rho / epsilon_0)) / np.amax(
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+#
+# This script checks that the 2D Langmuir fluid simulation gives the same
+# fields when the boxes are split in several tiles (the fluid push uses
+# tile-local scratch arrays) as when each box is a single tile.
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+# plotfile of the tiled run, and plotfile of the untiled run
+fn_tiled = sys.argv[1]
+fn_untiled = sys.argv[2]
+
+ds_tiled = yt.load(fn_tiled)
+ds_untiled = yt.load(fn_untiled)
+
+grid_tiled = ds_tiled.covering_grid(
+    level=0, left_edge=ds_tiled.domain_left_edge, dims=ds_tiled.domain_dimensions
+)
+grid_untiled = ds_untiled.covering_grid(
+    level=0, left_edge=ds_untiled.domain_left_edge, dims=ds_untiled.domain_dimensions
+)
+
+# The same operations are done on each grid point, so the results match to round-off
+tolerance_rel = 1e-12
+
+for field in ["Ex", "Ez", "jx", "jz", "rho"]:
+    F_tiled = grid_tiled["boxlib", field].v
+    F_untiled = grid_untiled["boxlib", field].v
+    error_rel = np.max(np.abs(F_tiled - F_untiled)) / np.max(np.abs(F_untiled))
+    print(f"{field}: relative difference between tiled and untiled runs = {error_rel}")
+    assert error_rel < tolerance_rel
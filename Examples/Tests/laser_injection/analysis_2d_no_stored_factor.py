@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+#
+# This script checks that the laser emitted when the transverse factor of the
+# amplitude is recomputed at each step (laser1.store_transverse_factor = 0)
+# matches the laser of the 2D laser injection test, in which this factor is
+# computed once, when the antenna particles are created.
+#
+# Both runs differ only in the positions at which the transverse envelope is
+# evaluated: the recomputed factor uses the current positions of the antenna
+# particles, which oscillate around their initial positions, with an amplitude
+# of at most eps*c/omega (eps = 0.05 is the maximum velocity of the antenna
+# particles, in units of c). The relative change of a Gaussian envelope of
+# waist w under such a displacement is at most of order (eps*c/omega)/w.
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+# plotfile of the run that recomputes the factor, and plotfile of the reference run
+fn_recomputed = sys.argv[1]
+fn_ref = sys.argv[2]
+
+# Parameters of the laser (from inputs_test_2d_laser_injection)
+wavelength = 1.0e-6
+waist = 5.0e-6
+eps = 0.05
+displacement = eps * wavelength / (2.0 * np.pi)
+rtol = displacement / waist
+
+ds_recomputed = yt.load(fn_recomputed)
+ds_ref = yt.load(fn_ref)
+
+grid_recomputed = ds_recomputed.covering_grid(
+    level=0,
+    left_edge=ds_recomputed.domain_left_edge,
+    dims=ds_recomputed.domain_dimensions,
+)
+grid_ref = ds_ref.covering_grid(
+    level=0, left_edge=ds_ref.domain_left_edge, dims=ds_ref.domain_dimensions
+)
+
+for field in ["Ex", "Ey", "Ez", "Bx", "By", "Bz"]:
+    F_recomputed = grid_recomputed["boxlib", field].v
+    F_ref = grid_ref["boxlib", field].v
+    error = np.max(np.abs(F_recomputed - F_ref)) / np.max(np.abs(F_ref))
+    print(f"{field}: relative difference = {error}, tolerance = {rtol}")
+    assert error < rtol
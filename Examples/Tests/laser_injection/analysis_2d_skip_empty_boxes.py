@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+#
+# This script checks that skipping the FDTD update in the boxes where the
+# fields are zero (warpx.fdtd_skip_empty_boxes = 1) gives exactly the same
+# fields as the 2D laser injection test, in which all the boxes are updated.
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+# plotfile of the run that skips the empty boxes, and plotfile of the reference run
+fn_skip = sys.argv[1]
+fn_ref = sys.argv[2]
+
+ds_skip = yt.load(fn_skip)
+ds_ref = yt.load(fn_ref)
+
+grid_skip = ds_skip.covering_grid(
+    level=0, left_edge=ds_skip.domain_left_edge, dims=ds_skip.domain_dimensions
+)
+grid_ref = ds_ref.covering_grid(
+    level=0, left_edge=ds_ref.domain_left_edge, dims=ds_ref.domain_dimensions
+)
+
+# The skipped updates would leave the fields unchanged, so the results must be identical
+for field in ["Ex", "Ey", "Ez", "Bx", "By", "Bz"]:
+    F_skip = grid_skip["boxlib", field].v
+    F_ref = grid_ref["boxlib", field].v
+    print(f"{field}: max difference = {np.max(np.abs(F_skip - F_ref))}")
+    assert np.array_equal(F_skip, F_ref)
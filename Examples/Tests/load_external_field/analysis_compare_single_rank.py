@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+# This test checks that reading the external field file with the domain
+# split over several MPI ranks, where each rank only reads the chunk of
+# the file that covers its boxes, gives the same fields and particle
+# trajectory as the single-rank run, up to roundoff.
+
+import sys
+
+import numpy as np
+import yt
+
+tolerance = 1.0e-12
+
+filename = sys.argv[1]
+benchmark = sys.argv[2]
+
+ds = yt.load(filename)
+ds_benchmark = yt.load(benchmark)
+
+ad = ds.covering_grid(level=0, left_edge=ds.domain_left_edge, dims=ds.domain_dimensions)
+ad_benchmark = ds_benchmark.covering_grid(
+    level=0,
+    left_edge=ds_benchmark.domain_left_edge,
+    dims=ds_benchmark.domain_dimensions,
+)
+
+for field in ["Br", "Bt", "Bz"]:
+    f = ad["boxlib", field].squeeze().v
+    fb = ad_benchmark["boxlib", field].squeeze().v
+    error = np.amax(np.abs(f - fb))
+    if np.amax(np.abs(fb)) != 0.0:
+        error /= np.amax(np.abs(fb))
+    print(f"field: {field}; error = {error}")
+    assert error < tolerance
+
+ad = ds.all_data()
+ad_benchmark = ds_benchmark.all_data()
+for attr in ["particle_position_x", "particle_position_y"]:
+    p = ad["proton", attr].to_ndarray()
+    pb = ad_benchmark["proton", attr].to_ndarray()
+    error = np.amax(np.abs(p - pb)) / np.amax(np.abs(pb))
+    print(f"particle attribute: {attr}; error = {error}")
+    assert error < tolerance
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+# The plugin is listed twice in warpx.plugins: it must be loaded only once,
+# so that its afterstep callback runs exactly once per step.
+
+import sys
+
+import numpy as np
+
+max_step = int(sys.argv[1])
+
+data = np.loadtxt("plugin_steps.txt", dtype=int, ndmin=2)
+steps = np.arange(1, max_step + 1)
+
+print(f"plugin output (step, number of calls):\n{data}")
+assert np.array_equal(data[:, 0], steps)
+assert np.array_equal(data[:, 1], steps)
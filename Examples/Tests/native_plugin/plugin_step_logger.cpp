@@ -0,0 +1,33 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+/* Example of a native plugin (see warpx.plugins): after each step, the
+ * step number and the number of calls of the callback are appended to the
+ * file plugin_steps.txt.
+ */
+#include "Python/callbacks.H"
+#include "WarpX.H"
+
+#include <AMReX_ParallelDescriptor.H>
+
+#include <fstream>
+
+
+namespace
+{
+    int n_calls = 0;
+}
+
+extern "C" void warpx_plugin_init ()
+{
+    InstallNativeCallback("afterstep", [] () {
+        ++n_calls;
+        if (!amrex::ParallelDescriptor::IOProcessor()) { return; }
+        auto const& warpx = WarpX::GetInstance();
+        std::ofstream ofs("plugin_steps.txt", std::ios::app);
+        ofs << warpx.getistep(0) << " " << n_calls << "\n";
+    });
+}
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+"""
+This script compares the fields of level 0 of a plotfile with those of a
+reference plotfile of the same Alfven wave test, run with a different
+configuration of the hybrid-PIC solver (e.g. with mesh refinement or with
+deep halos).
+
+For each field, the maximum difference is normalized by the amplitude of the
+variations of the reference field around its mean, and must be below the
+tolerance.
+
+Usage: analysis_compare.py <plotfile> <reference plotfile> <tolerance> <fields...>
+"""
+
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+filename = sys.argv[1]
+ref_filename = sys.argv[2]
+tolerance = float(sys.argv[3])
+fields = sys.argv[4:]
+assert len(fields) > 0
+
+
+def read_level0(fn, field):
+    ds = yt.load(fn)
+    grid = ds.covering_grid(
+        level=0, left_edge=ds.domain_left_edge, dims=ds.domain_dimensions
+    )
+    return grid[("boxlib", field)].to_ndarray()
+
+
+for field in fields:
+    f = read_level0(filename, field)
+    f_ref = read_level0(ref_filename, field)
+    assert f.shape == f_ref.shape, f"{field}: {f.shape} != {f_ref.shape}"
+
+    amplitude = np.max(np.abs(f_ref - np.mean(f_ref)))
+    assert amplitude > 0.0, f"{field}: the reference field is uniform"
+    error = np.max(np.abs(f - f_ref)) / amplitude
+    print(f"{field}: relative difference {error:.3e} (tolerance {tolerance:.1e})")
+    assert error < tolerance, f"{field}: {error} >= {tolerance}"
@@ -0,0 +1 @@
+../../analysis_default_regression.py
\ No newline at end of file
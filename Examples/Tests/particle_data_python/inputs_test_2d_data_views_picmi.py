@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+#
+# --- Test the zero-copy views of the particle and field data: they share the
+# --- memory of WarpX, and they raise an error once the data they refer to has
+# --- been reallocated, resized or reordered (redistribution, sort, load balancing).
+
+import numpy as np
+
+from pywarpx import fields, libwarpx, particle_containers, picmi
+
+##########################
+# numerics components
+##########################
+
+nx = 64
+nz = 64
+
+xmin = 0.0
+xmax = 1.0e-5
+zmin = 0.0
+zmax = 1.0e-5
+
+grid = picmi.Cartesian2DGrid(
+    number_of_cells=[nx, nz],
+    lower_bound=[xmin, zmin],
+    upper_bound=[xmax, zmax],
+    lower_boundary_conditions=["periodic", "periodic"],
+    upper_boundary_conditions=["periodic", "periodic"],
+    lower_boundary_conditions_particles=["periodic", "periodic"],
+    upper_boundary_conditions_particles=["periodic", "periodic"],
+    warpx_max_grid_size=32,
+)
+
+solver = picmi.ElectromagneticSolver(grid=grid, method="Yee", cfl=0.99)
+
+##########################
+# physics components
+##########################
+
+electrons = picmi.Species(particle_type="electron", name="electrons")
+
+##########################
+# simulation setup
+##########################
+
+# Load balancing at each step, whatever the gain, so that the fields are
+# reallocated on a new DistributionMapping
+sim = picmi.Simulation(
+    solver=solver,
+    max_steps=10,
+    verbose=1,
+    warpx_load_balance_intervals=1,
+    warpx_load_balance_efficiency_ratio_threshold=1.0e-10,
+)
+
+sim.add_species(electrons, layout=None)
+
+sim.initialize_inputs()
+sim.initialize_warpx()
+
+
+def to_host(array):
+    "Copy a cupy array to the host, and leave a numpy array unchanged"
+    return array.get() if hasattr(array, "get") else array
+
+
+def check_invalid(views):
+    "Check that the views are invalid, and that accessing them raises an error"
+    assert not views.is_valid
+    try:
+        views[0]
+    except RuntimeError:
+        pass
+    else:
+        raise AssertionError("Accessing invalidated views did not raise an error")
+
+
+##########################
+# particle views
+##########################
+
+nparticles = 1000
+rng = np.random.default_rng(seed=4213)
+x = xmin + (xmax - xmin) * rng.uniform(0.01, 0.99, nparticles)
+z = zmin + (zmax - zmin) * rng.uniform(0.01, 0.99, nparticles)
+
+elec_wrapper = particle_containers.ParticleContainerWrapper("electrons")
+elec_wrapper.add_particles(x=x, z=z, ux=0.0, uy=0.0, uz=0.0, w=1.0)
+pc = elec_wrapper.particle_container
+
+views = elec_wrapper.get_particle_views()
+assert views.is_valid
+assert len(views) == len(elec_wrapper.get_particle_real_arrays("x", 0))
+
+# The views hold the same data as the copies, and share the memory of WarpX
+x_views = np.concatenate([to_host(tile["x"]) for tile in views])
+x_copies = np.concatenate(elec_wrapper.get_particle_real_arrays("x", 0, True))
+assert np.array_equal(x_views, x_copies)
+
+for tile in views:
+    tile["ux"][:] = 1.0
+ux_copies = np.concatenate(elec_wrapper.get_particle_real_arrays("ux", 0, True))
+assert np.all(ux_copies == 1.0)
+
+# Fetching other data does not invalidate the views
+elec_wrapper.get_particle_idcpu_arrays(0, copy_to_host=True)
+assert views.is_valid
+
+# A redistribution invalidates them
+pc.redistribute()
+check_invalid(views)
+
+# So does a sort
+views = elec_wrapper.get_particle_views()
+assert views.is_valid
+pc.sort_particles_by_bin([4, 4])
+check_invalid(views)
+
+##########################
+# field views
+##########################
+
+Ex = fields.ExWrapper()
+field_views = Ex.get_views()
+assert field_views.is_valid
+
+for block in field_views:
+    block[...] = 2.0
+assert np.all(Ex[...] == 2.0)
+
+# Operations on the particles do not invalidate the field views
+pc.redistribute()
+assert field_views.is_valid
+
+# The step invalidates the particle views, and the load balancing done at the
+# second step reallocates the fields (with MPI, where load balancing is done)
+views = elec_wrapper.get_particle_views()
+sim.step(2)
+check_invalid(views)
+if libwarpx.libwarpx_so.Config.have_mpi:
+    check_invalid(field_views)
+else:
+    assert field_views.is_valid
+
+# The views fetched again are valid
+assert elec_wrapper.get_particle_views().is_valid
+assert Ex.get_views().is_valid
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+#
+# --- Test that the multithreaded CPU bin sort of WarpXParticleContainer.SortParticlesByBin
+# --- gives the same permutation as a serial stable counting sort, which is the order
+# --- produced by amrex::DenseBins.
+# --- With --tiles, the box is split into several particle tiles, which are sorted
+# --- independently, each with its own bins.
+
+import argparse
+import os
+import sys
+
+# The parallel bin sort is only used with more than one thread
+os.environ["OMP_NUM_THREADS"] = "4"
+
+import numpy as np  # noqa: E402
+
+from pywarpx import particle_containers, particles, picmi  # noqa: E402
+
+# Create the parser and add the argument
+parser = argparse.ArgumentParser()
+parser.add_argument(
+    "-t",
+    "--tiles",
+    action="store_true",
+    help="Whether the box should be split into several particle tiles",
+)
+
+# Parse the input
+args, left = parser.parse_known_args()
+sys.argv = sys.argv[:1] + left
+
+##########################
+# numerics parameters
+##########################
+
+dt = 7.5e-10
+
+# --- grid
+
+nx = 64
+nz = 64
+
+xmin = 0
+xmax = 0.03
+zmin = 0
+zmax = 0.03
+
+# --- bins of the sort, which divide the grid evenly
+
+bin_size = [4, 4]
+
+# --- particle tiles, which divide the box evenly
+
+if args.tiles:
+    tile_size = [32, 32]
+else:
+    tile_size = [nx, nz]
+ntiles = (nx // tile_size[0]) * (nz // tile_size[1])
+
+# --- enough particles in each tile for its sort to be split across all the threads
+
+nparticles = 20000 * ntiles
+
+##########################
+# numerics components
+##########################
+
+grid = picmi.Cartesian2DGrid(
+    number_of_cells=[nx, nz],
+    lower_bound=[xmin, zmin],
+    upper_bound=[xmax, zmax],
+    lower_boundary_conditions=["dirichlet", "periodic"],
+    upper_boundary_conditions=["dirichlet", "periodic"],
+    lower_boundary_conditions_particles=["absorbing", "periodic"],
+    upper_boundary_conditions_particles=["absorbing", "periodic"],
+    moving_window_velocity=None,
+    warpx_max_grid_size=nx,
+)
+
+solver = picmi.ElectrostaticSolver(
+    grid=grid,
+    method="Multigrid",
+    required_precision=1e-6,
+    warpx_self_fields_verbosity=0,
+)
+
+##########################
+# physics components
+##########################
+
+electrons = picmi.Species(particle_type="electron", name="electrons")
+
+##########################
+# simulation setup
+##########################
+
+sim = picmi.Simulation(solver=solver, time_step_size=dt, max_steps=1, verbose=1)
+
+sim.add_species(electrons, layout=None)
+
+particles.tile_size = tile_size
+
+sim.initialize_inputs()
+sim.initialize_warpx()
+
+##########################
+# add the particles in a random order
+##########################
+
+rng = np.random.default_rng(seed=3578)
+x = xmin + (xmax - xmin) * rng.uniform(0.01, 0.99, nparticles)
+z = zmin + (zmax - zmin) * rng.uniform(0.01, 0.99, nparticles)
+
+elec_wrapper = particle_containers.ParticleContainerWrapper("electrons")
+elec_wrapper.add_particles(x=x, z=z, ux=0.0, uy=0.0, uz=0.0, w=1.0)
+
+x_before = [
+    np.array(a) for a in elec_wrapper.get_particle_real_arrays("x", 0, copy_to_host=True)
+]
+z_before = [
+    np.array(a) for a in elec_wrapper.get_particle_real_arrays("z", 0, copy_to_host=True)
+]
+idcpu_before = [
+    np.array(a) for a in elec_wrapper.get_particle_idcpu_arrays(0, copy_to_host=True)
+]
+assert len(idcpu_before) == ntiles
+assert sum(len(a) for a in idcpu_before) == nparticles
+
+##########################
+# reference: stable counting sort of the bin indices of each tile
+##########################
+
+dx = (xmax - xmin) / nx
+dz = (zmax - zmin) / nz
+nbins_x = tile_size[0] // bin_size[0]
+permutations = []
+for x, z in zip(x_before, z_before):
+    ix = np.clip(np.floor((x - xmin) / dx).astype(int), 0, nx - 1)
+    iz = np.clip(np.floor((z - zmin) / dz).astype(int), 0, nz - 1)
+    # The bins are relative to the lower corner of the tile
+    ix -= (ix[0] // tile_size[0]) * tile_size[0]
+    iz -= (iz[0] // tile_size[1]) * tile_size[1]
+    assert np.all((ix >= 0) & (ix < tile_size[0]))
+    assert np.all((iz >= 0) & (iz < tile_size[1]))
+    bin_index = ix // bin_size[0] + nbins_x * (iz // bin_size[1])
+    permutations.append(np.argsort(bin_index, kind="stable"))
+
+##########################
+# sort and compare
+##########################
+
+elec_wrapper.particle_container.sort_particles_by_bin(bin_size)
+
+x_after = elec_wrapper.get_particle_real_arrays("x", 0, copy_to_host=True)
+z_after = elec_wrapper.get_particle_real_arrays("z", 0, copy_to_host=True)
+idcpu_after = elec_wrapper.get_particle_idcpu_arrays(0, copy_to_host=True)
+assert len(idcpu_after) == ntiles
+
+for t, permutation in enumerate(permutations):
+    assert len(np.unique(idcpu_after[t])) == len(permutation)
+    assert np.array_equal(np.array(idcpu_after[t]), idcpu_before[t][permutation])
+    assert np.array_equal(np.array(x_after[t]), x_before[t][permutation])
+    assert np.array_equal(np.array(z_after[t]), z_before[t][permutation])
@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+#
+# This script checks that the particle-reduced fields that diag1 computes
+# together, in one sweep over the particles of each species, match those of
+# the diagnostics that compute a single field each (an average, a filtered
+# average and a sum).
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+fn_fused = sys.argv[1]
+step = fn_fused[-6:]
+
+ds_fused = yt.load(fn_fused)
+ad_fused = ds_fused.covering_grid(
+    level=0, left_edge=ds_fused.domain_left_edge, dims=ds_fused.domain_dimensions
+)
+
+for field in ["z", "uz_filt", "jz"]:
+    ds_single = yt.load(f"diags/diag_{field}{step}")
+    ad_single = ds_single.covering_grid(
+        level=0,
+        left_edge=ds_single.domain_left_edge,
+        dims=ds_single.domain_dimensions,
+    )
+    for species in ["electrons", "protons", "photons"]:
+        name = f"{field}_{species}"
+        F_fused = ad_fused[("boxlib", name)].v
+        F_single = ad_single[("boxlib", name)].v
+        # The same values are added in the same order, up to the order of the
+        # atomic additions at the boundaries of the tiles
+        print(f"{name}: max difference = {np.max(np.abs(F_fused - F_single))}")
+        assert np.allclose(F_fused, F_single, rtol=1e-12, atol=0.0)
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+#
+# --- Test that the scratch MultiFab pool hands out again a MultiFab that was
+# --- given back, only for a request with the same layout: a different index
+# --- type, number of guard cells or number of components needs a new MultiFab.
+
+from pywarpx import libwarpx, picmi
+
+##########################
+# numerics components
+##########################
+
+nx = 64
+nz = 64
+
+grid = picmi.Cartesian2DGrid(
+    number_of_cells=[nx, nz],
+    lower_bound=[0.0, 0.0],
+    upper_bound=[1.0e-5, 1.0e-5],
+    lower_boundary_conditions=["periodic", "periodic"],
+    upper_boundary_conditions=["periodic", "periodic"],
+    warpx_max_grid_size=32,
+)
+
+solver = picmi.ElectromagneticSolver(grid=grid, method="Yee", cfl=0.99)
+
+##########################
+# simulation setup
+##########################
+
+sim = picmi.Simulation(solver=solver, max_steps=1, verbose=1)
+
+sim.initialize_inputs()
+sim.initialize_warpx()
+
+warpx = sim.extension.warpx
+amr = libwarpx.amr
+pool = warpx.scratch_multifab_pool()
+
+ba = warpx.boxArray(0)
+dm = warpx.DistributionMap(0)
+# same boxes as ba, but with a nodal index type along z
+ba_ez = warpx.multifab("Efield_fp", libwarpx.libwarpx_so.Direction(2), 0).box_array()
+assert ba_ez.ix_type() != ba.ix_type()
+
+ng0 = amr.IntVect(0, 0)
+ng1 = amr.IntVect(1, 1)
+
+# start from an empty pool
+pool.clear()
+assert pool.bytes_cached == 0
+
+
+def check_get(ba, ncomp, ngrow, reused):
+    """Get a MultiFab from the pool, check whether it was reused, and give it back"""
+    num_allocations = pool.num_allocations
+    num_reuses = pool.num_reuses
+    scratch = pool.get(ba, dm, ncomp, ngrow)
+    mf = scratch.multifab
+    assert mf.n_comp == ncomp
+    assert mf.n_grow_vect == ngrow
+    assert mf.box_array().ix_type() == ba.ix_type()
+    assert pool.bytes_cached >= 0
+    scratch.reset()
+    assert scratch.multifab is None
+    assert pool.bytes_in_use == 0
+    assert pool.num_reuses == num_reuses + (1 if reused else 0)
+    assert pool.num_allocations == num_allocations + (0 if reused else 1)
+
+
+# the first request allocates, the same request then reuses the MultiFab
+check_get(ba, 1, ng0, reused=False)
+check_get(ba, 1, ng0, reused=True)
+
+# a different index type, number of guard cells or number of components allocates
+check_get(ba_ez, 1, ng0, reused=False)
+check_get(ba, 1, ng1, reused=False)
+check_get(ba, 2, ng0, reused=False)
+
+# each of these layouts is now cached and reused
+check_get(ba_ez, 1, ng0, reused=True)
+check_get(ba, 1, ng1, reused=True)
+check_get(ba, 2, ng0, reused=True)
+check_get(ba, 1, ng0, reused=True)
+
+# a MultiFab in use is not handed out again for a second request with the same layout
+num_allocations = pool.num_allocations
+num_reuses = pool.num_reuses
+first = pool.get(ba, dm, 1, ng0)
+second = pool.get(ba, dm, 1, ng0)
+assert pool.num_reuses == num_reuses + 1
+assert pool.num_allocations == num_allocations + 1
+first.reset()
+second.reset()
+
+assert pool.high_water_mark >= pool.bytes_cached
+
+# the cleared pool allocates again
+pool.clear()
+check_get(ba, 1, ng0, reused=False)
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+#
+# This script checks that the load balancing gives exactly the same fields and
+# particles whether the data of the boxes that stay on their rank is kept in
+# place (test_3d_reduced_diags_load_balance_costs_heuristic) or all the boxes
+# are copied with one Redistribute (amrex.mf.alloc_single_chunk = 1).
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+# plotfile of the run with single-chunk allocation, and plotfile of the reference run
+fn_single_chunk = sys.argv[1]
+fn_ref = sys.argv[2]
+
+ds_single_chunk = yt.load(fn_single_chunk)
+ds_ref = yt.load(fn_ref)
+
+grid_single_chunk = ds_single_chunk.covering_grid(
+    level=0,
+    left_edge=ds_single_chunk.domain_left_edge,
+    dims=ds_single_chunk.domain_dimensions,
+)
+grid_ref = ds_ref.covering_grid(
+    level=0, left_edge=ds_ref.domain_left_edge, dims=ds_ref.domain_dimensions
+)
+
+fields = [f for f in ds_ref.field_list if f[0] == "boxlib"]
+assert len(fields) > 0
+for field in fields:
+    F_single_chunk = grid_single_chunk[field].v
+    F_ref = grid_ref[field].v
+    print(f"{field[1]}: max difference = {np.max(np.abs(F_single_chunk - F_ref))}")
+    assert np.array_equal(F_single_chunk, F_ref)
+
+
+# The particles are compared in the order of their ids
+def id_order(ad):
+    return np.lexsort(
+        (ad["electrons", "particle_id"].v, ad["electrons", "particle_cpu"].v)
+    )
+
+
+ad_single_chunk = ds_single_chunk.all_data()
+ad_ref = ds_ref.all_data()
+order_single_chunk = id_order(ad_single_chunk)
+order_ref = id_order(ad_ref)
+for attribute in [
+    "particle_position_x",
+    "particle_position_y",
+    "particle_position_z",
+    "particle_momentum_x",
+    "particle_momentum_y",
+    "particle_momentum_z",
+    "particle_weight",
+]:
+    a_single_chunk = ad_single_chunk["electrons", attribute].v[order_single_chunk]
+    a_ref = ad_ref["electrons", attribute].v[order_ref]
+    print(f"electrons {attribute}: identical = {np.array_equal(a_single_chunk, a_ref)}")
+    assert np.array_equal(a_single_chunk, a_ref)
@@ -289,67 +289,67 @@ def do_analysis(single_precision=False):
     )  # Field Reduction using integral
     Edotjdata = np.genfromtxt("./diags/reducedfiles/Edotj.txt")  # E dot j maximum
 
-    # First index "1" points to the values written at the last time step
-    values_rd["field energy"] = EFdata[1][2]
-    values_rd["field energy in quarter of simulation domain"] = FR_Integraldata[1][2]
-    values_rd["particle energy"] = EPdata[1][2]
-    values_rd["electrons: particle energy"] = EPdata[1][3]
-    values_rd["protons: particle energy"] = EPdata[1][4]
-    values_rd["photons: particle energy"] = EPdata[1][5]
-    values_rd["mean particle energy"] = EPdata[1][6]
-    values_rd["electrons: mean particle energy"] = EPdata[1][7]
-    values_rd["protons: mean particle energy"] = EPdata[1][8]
-    values_rd["photons: mean particle energy"] = EPdata[1][9]
-    values_rd["field momentum in x"] = PFdata[1][2]
-    values_rd["field momentum in y"] = PFdata[1][3]
-    values_rd["field momentum in z"] = PFdata[1][4]
-    values_rd["particle momentum in x"] = PPdata[1][2]
-    values_rd["particle momentum in y"] = PPdata[1][3]
-    values_rd["particle momentum in z"] = PPdata[1][4]
-    values_rd["electrons: particle momentum in x"] = PPdata[1][5]
-    values_rd["electrons: particle momentum in y"] = PPdata[1][6]
-    values_rd["electrons: particle momentum in z"] = PPdata[1][7]
-    values_rd["protons: particle momentum in x"] = PPdata[1][8]
-    values_rd["protons: particle momentum in y"] = PPdata[1][9]
-    values_rd["protons: particle momentum in z"] = PPdata[1][10]
-    values_rd["photons: particle momentum in x"] = PPdata[1][11]
-    values_rd["photons: particle momentum in y"] = PPdata[1][12]
-    values_rd["photons: particle momentum in z"] = PPdata[1][13]
-    values_rd["mean particle momentum in x"] = PPdata[1][14]
-    values_rd["mean particle momentum in y"] = PPdata[1][15]
-    values_rd["mean particle momentum in z"] = PPdata[1][16]
-    values_rd["electrons: mean particle momentum in x"] = PPdata[1][17]
-    values_rd["electrons: mean particle momentum in y"] = PPdata[1][18]
-    values_rd["electrons: mean particle momentum in z"] = PPdata[1][19]
-    values_rd["protons: mean particle momentum in x"] = PPdata[1][20]
-    values_rd["protons: mean particle momentum in y"] = PPdata[1][21]
-    values_rd["protons: mean particle momentum in z"] = PPdata[1][22]
-    values_rd["photons: mean particle momentum in x"] = PPdata[1][23]
-    values_rd["photons: mean particle momentum in y"] = PPdata[1][24]
-    values_rd["photons: mean particle momentum in z"] = PPdata[1][25]
-    values_rd["maximum of |Ex|"] = MFdata[1][2]
-    values_rd["maximum of |Ey|"] = MFdata[1][3]
-    values_rd["maximum of |Ez|"] = MFdata[1][4]
-    values_rd["maximum of |E|"] = MFdata[1][5]
-    values_rd["maximum of |Bx|"] = MFdata[1][6]
-    values_rd["maximum of |By|"] = MFdata[1][7]
-    values_rd["maximum of |Bz|"] = MFdata[1][8]
-    values_rd["maximum of |B|"] = MFdata[1][9]
-    values_rd["maximum of rho"] = MRdata[1][2]
-    values_rd["minimum of rho"] = MRdata[1][3]
-    values_rd["electrons: maximum of |rho|"] = MRdata[1][4]
-    values_rd["protons: maximum of |rho|"] = MRdata[1][5]
-    values_rd["number of particles"] = NPdata[1][2]
-    values_rd["electrons: number of particles"] = NPdata[1][3]
-    values_rd["protons: number of particles"] = NPdata[1][4]
-    values_rd["photons: number of particles"] = NPdata[1][5]
-    values_rd["sum of weights"] = NPdata[1][6]
-    values_rd["electrons: sum of weights"] = NPdata[1][7]
-    values_rd["protons: sum of weights"] = NPdata[1][8]
-    values_rd["photons: sum of weights"] = NPdata[1][9]
-    values_rd["maximum of |B| from generic field reduction"] = FR_Maxdata[1][2]
-    values_rd["minimum of x*Ey*Bz"] = FR_Mindata[1][2]
-    values_rd["maximum of Edotj"] = Edotjdata[1][2]
+    # First index "-1" points to the values written at the last time step
+    values_rd["field energy"] = EFdata[-1][2]
+    values_rd["field energy in quarter of simulation domain"] = FR_Integraldata[-1][2]
+    values_rd["particle energy"] = EPdata[-1][2]
+    values_rd["electrons: particle energy"] = EPdata[-1][3]
+    values_rd["protons: particle energy"] = EPdata[-1][4]
+    values_rd["photons: particle energy"] = EPdata[-1][5]
+    values_rd["mean particle energy"] = EPdata[-1][6]
+    values_rd["electrons: mean particle energy"] = EPdata[-1][7]
+    values_rd["protons: mean particle energy"] = EPdata[-1][8]
+    values_rd["photons: mean particle energy"] = EPdata[-1][9]
+    values_rd["field momentum in x"] = PFdata[-1][2]
+    values_rd["field momentum in y"] = PFdata[-1][3]
+    values_rd["field momentum in z"] = PFdata[-1][4]
+    values_rd["particle momentum in x"] = PPdata[-1][2]
+    values_rd["particle momentum in y"] = PPdata[-1][3]
+    values_rd["particle momentum in z"] = PPdata[-1][4]
+    values_rd["electrons: particle momentum in x"] = PPdata[-1][5]
+    values_rd["electrons: particle momentum in y"] = PPdata[-1][6]
+    values_rd["electrons: particle momentum in z"] = PPdata[-1][7]
+    values_rd["protons: particle momentum in x"] = PPdata[-1][8]
+    values_rd["protons: particle momentum in y"] = PPdata[-1][9]
+    values_rd["protons: particle momentum in z"] = PPdata[-1][10]
+    values_rd["photons: particle momentum in x"] = PPdata[-1][11]
+    values_rd["photons: particle momentum in y"] = PPdata[-1][12]
+    values_rd["photons: particle momentum in z"] = PPdata[-1][13]
+    values_rd["mean particle momentum in x"] = PPdata[-1][14]
+    values_rd["mean particle momentum in y"] = PPdata[-1][15]
+    values_rd["mean particle momentum in z"] = PPdata[-1][16]
+    values_rd["electrons: mean particle momentum in x"] = PPdata[-1][17]
+    values_rd["electrons: mean particle momentum in y"] = PPdata[-1][18]
+    values_rd["electrons: mean particle momentum in z"] = PPdata[-1][19]
+    values_rd["protons: mean particle momentum in x"] = PPdata[-1][20]
+    values_rd["protons: mean particle momentum in y"] = PPdata[-1][21]
+    values_rd["protons: mean particle momentum in z"] = PPdata[-1][22]
+    values_rd["photons: mean particle momentum in x"] = PPdata[-1][23]
+    values_rd["photons: mean particle momentum in y"] = PPdata[-1][24]
+    values_rd["photons: mean particle momentum in z"] = PPdata[-1][25]
+    values_rd["maximum of |Ex|"] = MFdata[-1][2]
+    values_rd["maximum of |Ey|"] = MFdata[-1][3]
+    values_rd["maximum of |Ez|"] = MFdata[-1][4]
+    values_rd["maximum of |E|"] = MFdata[-1][5]
+    values_rd["maximum of |Bx|"] = MFdata[-1][6]
+    values_rd["maximum of |By|"] = MFdata[-1][7]
+    values_rd["maximum of |Bz|"] = MFdata[-1][8]
+    values_rd["maximum of |B|"] = MFdata[-1][9]
+    values_rd["maximum of rho"] = MRdata[-1][2]
+    values_rd["minimum of rho"] = MRdata[-1][3]
+    values_rd["electrons: maximum of |rho|"] = MRdata[-1][4]
+    values_rd["protons: maximum of |rho|"] = MRdata[-1][5]
+    values_rd["number of particles"] = NPdata[-1][2]
+    values_rd["electrons: number of particles"] = NPdata[-1][3]
+    values_rd["protons: number of particles"] = NPdata[-1][4]
+    values_rd["photons: number of particles"] = NPdata[-1][5]
+    values_rd["sum of weights"] = NPdata[-1][6]
+    values_rd["electrons: sum of weights"] = NPdata[-1][7]
+    values_rd["protons: sum of weights"] = NPdata[-1][8]
+    values_rd["photons: sum of weights"] = NPdata[-1][9]
+    values_rd["maximum of |B| from generic field reduction"] = FR_Maxdata[-1][2]
+    values_rd["minimum of x*Ey*Bz"] = FR_Mindata[-1][2]
+    values_rd["maximum of Edotj"] = Edotjdata[-1][2]
 
     # --------------------------------------------------------------------------------------------------
     # Part 3: compare values from plotfiles and reduced diagnostics and print output
@@ -0,0 +1,57 @@
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+
+class DataViews(list):
+    """List of zero-copy views of the particle or field data of the local tiles.
+
+    The elements share the memory of the WarpX data, without any copy. Each
+    array is a numpy array (on CPU or with managed memory) or a cupy array (on GPU),
+    so it exposes ``__array_interface__`` or ``__cuda_array_interface__``, and
+    ``__dlpack__``, and can be passed without copy to other frameworks, e.g.,
+    with ``torch.from_dlpack``.
+
+    The views are only valid until WarpX reallocates, resizes or reorders the
+    data, e.g., when the particles are redistributed or sorted, or when the
+    fields are reallocated by load balancing. WarpX counts these operations:
+    accessing the elements of the list once the count has changed raises a
+    ``RuntimeError``, and the views must then be fetched again.
+
+    Parameters
+    ----------
+    views : iterable
+        The zero-copy views
+    get_generation : callable
+        Function returning the current count of the operations that
+        invalidate the views
+    """
+
+    def __init__(self, views, get_generation):
+        super().__init__(views)
+        self._get_generation = get_generation
+        self.generation = get_generation()
+
+    @property
+    def is_valid(self):
+        "Whether the memory referenced by the views is unchanged"
+        return self.generation == self._get_generation()
+
+    def check_valid(self):
+        "Raise an error if the views have been invalidated"
+        if not self.is_valid:
+            raise RuntimeError(
+                "The data views were invalidated since they were fetched "
+                "(the particles were redistributed, sorted or resized, or the fields "
+                "were reallocated). They must be fetched again."
+            )
+
+    def __getitem__(self, index):
+        self.check_valid()
+        return super().__getitem__(index)
+
+    def __iter__(self):
+        self.check_valid()
+        return super().__iter__()
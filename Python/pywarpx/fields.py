@@ -59,6 +59,7 @@ except ImportError:
     npes = 1
 
 from ._libwarpx import libwarpx
+from .data_views import DataViews
 
 
 class _MultiFABWrapper(object):
@@ -559,6 +560,27 @@ class _MultiFABWrapper(object):
                 else:
                     mf_arr[block_slices] = value
 
+    def get_views(self):
+        """Return zero-copy views of the field on all the local blocks.
+
+        The arrays share the memory of the MultiFab and follow the same
+        conventions as the blocks used by ``__getitem__``: they always have
+        four dimensions, the last one being the component, and include the
+        ghost cells only if ``include_ghosts`` is True. They are only valid
+        until the fields are reallocated on a new grid layout (e.g., at load
+        balancing): the returned list then raises an error when it is
+        accessed (see ``DataViews``).
+
+        Returns
+        -------
+        DataViews
+            List of numpy or cupy arrays, one per local block
+        """
+        return DataViews(
+            [self._get_field(mfi) for mfi in self.mf],
+            libwarpx.warpx.get_field_data_generation,
+        )
+
     def min(self, *args):
         return self.mf.min(*args)
 
@@ -9,6 +9,7 @@
 import numpy as np
 
 from ._libwarpx import libwarpx
+from .data_views import DataViews
 from .LoadThirdParty import load_cupy
 
 
@@ -367,6 +368,56 @@ class ParticleContainerWrapper(object):
 
         return data_array
 
+    def get_particle_views(self, level=0):
+        """
+        This returns zero-copy views of all the particle data, on each tile
+        for this process, fetched with a single loop over the tiles.
+
+        The arrays are numpy or cupy arrays that share the underlying memory
+        buffer with WarpX, and can be handed to other frameworks without copy
+        through ``__array_interface__``, ``__cuda_array_interface__`` or
+        ``__dlpack__``. They are only valid until the particle tiles are
+        reallocated, resized or reordered (e.g., by a redistribution, a sort
+        or an injection): the returned list then raises an error when it is
+        accessed (see ``DataViews``).
+
+        Parameters
+        ----------
+
+        level          : int
+            The refinement level to reference (default=0)
+
+        Returns
+        -------
+
+        DataViews
+            List with, for each tile, a dictionary mapping the names of the
+            real and int components, and ``idcpu``, to the particle arrays
+        """
+        xp, cupy_status = load_cupy()
+        if cupy_status is not None:
+            libwarpx.amr.Print(cupy_status)
+
+        pc = self.particle_container
+        real_names = pc.real_soa_names
+        int_names = pc.int_soa_names
+
+        views = DataViews([], lambda: pc.data_generation)
+        for pti in libwarpx.libwarpx_so.WarpXParIter(pc, level):
+            soa = pti.soa()
+            tile_views = {"idcpu": xp.array(soa.get_idcpu_data(), copy=False)}
+            for comp_idx, comp_name in enumerate(real_names):
+                tile_views[comp_name] = xp.array(
+                    soa.get_real_data(comp_idx), copy=False
+                )
+            for comp_idx, comp_name in enumerate(int_names):
+                tile_views[comp_name] = xp.array(
+                    soa.get_int_data(comp_idx), copy=False
+                )
+            views.append(tile_views)
+
+        return views
+
     def get_particle_idcpu(self, level=0, copy_to_host=False):
         """
         Return a list of numpy or cupy arrays containing the particle 'idcpu'
@@ -2,6 +2,7 @@
 
 #include "Diagnostics/ComputeDiagFunctors/ComputeDiagFunctor.H"
 #include "Particles/MultiParticleContainer.H"
+#include "Utils/ScratchMultiFabPool.H"
 #include "WarpX.H"
 
 #include <ablastr/coarsen/sample.H>
@@ -31,7 +32,9 @@ PartPerCellFunctor::operator()(amrex::MultiFab& mf_dst, const int dcomp, const i
     // the operations performend in the CoarsenAndInterpolate function.
     constexpr int ng = 1;
     // Temporary cell-centered, single-component MultiFab for storing particles per cell.
-    amrex::MultiFab ppc_mf(warpx.boxArray(m_lev), warpx.DistributionMap(m_lev), 1, ng);
+    ScratchMultiFab ppc_mf_scratch = warpx.GetScratchPool().Get(
+        warpx.boxArray(m_lev), warpx.DistributionMap(m_lev), 1, amrex::IntVect(ng), "PartPerCell");
+    amrex::MultiFab& ppc_mf = *ppc_mf_scratch;
     // Set value to 0, and increment the value in each cell with ppc.
     ppc_mf.setVal(0._rt);
     // Compute ppc which includes a summation over all species.
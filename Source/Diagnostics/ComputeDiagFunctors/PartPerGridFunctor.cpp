@@ -2,6 +2,7 @@
 
 #include "Diagnostics/ComputeDiagFunctors/ComputeDiagFunctor.H"
 #include "Particles/MultiParticleContainer.H"
+#include "Utils/ScratchMultiFabPool.H"
 #include "WarpX.H"
 
 #include <ablastr/coarsen/sample.H>
@@ -40,7 +41,9 @@ PartPerGridFunctor::operator()(amrex::MultiFab& mf_dst, const int dcomp, const i
     constexpr int ng = 1;
     // Temporary MultiFab containing number of particles per grid.
     // (stored as constant for all cells in each grid)
-    amrex::MultiFab ppg_mf(warpx.boxArray(m_lev), warpx.DistributionMap(m_lev), 1, ng);
+    ScratchMultiFab ppg_mf_scratch = warpx.GetScratchPool().Get(
+        warpx.boxArray(m_lev), warpx.DistributionMap(m_lev), 1, amrex::IntVect(ng), "PartPerGrid");
+    amrex::MultiFab& ppg_mf = *ppg_mf_scratch;
 #ifdef AMREX_USE_OMP
 #pragma omp parallel
 #endif
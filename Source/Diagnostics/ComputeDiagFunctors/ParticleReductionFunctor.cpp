@@ -5,59 +5,133 @@
 #include "Particles/MultiParticleContainer.H"
 #include "Particles/WarpXParticleContainer.H"
 #include "Utils/Parser/ParserUtils.H"
+#include "Utils/ScratchMultiFabPool.H"
+#include "Utils/TextMsg.H"
 #include "WarpX.H"
 
 #include <ablastr/coarsen/sample.H>
 
 #include <AMReX_Array.H>
 #include <AMReX_BLassert.H>
+#include <AMReX_GpuContainers.H>
 #include <AMReX_IntVect.H>
 #include <AMReX_MultiFab.H>
 #include <AMReX_REAL.H>
 
+#include <utility>
+
 using namespace amrex::literals;
 
-ParticleReductionFunctor::ParticleReductionFunctor (const amrex::MultiFab* mf_src, const int lev,
-        const amrex::IntVect crse_ratio, const std::string& fn_str,
-        const int ispec, const bool do_average,
-        const bool do_filter, const std::string& filter_str, const int ncomp)
-    : ComputeDiagFunctor(ncomp, crse_ratio), m_lev(lev), m_ispec(ispec), m_do_average(do_average), m_do_filter(do_filter)
-{
-    // mf_src will not be used, let's make sure it's null.
-    AMREX_ALWAYS_ASSERT(mf_src == nullptr);
-    // Write only in one output component.
-    AMREX_ALWAYS_ASSERT(ncomp == 1);
+ParticleReductionGroup::ParticleReductionGroup (const int lev, const int ispec)
+    : m_lev(lev), m_ispec(ispec)
+{}
 
+int
+ParticleReductionGroup::AddReduction (const std::string& fn_str, const bool do_average,
+                                      const bool do_filter, const std::string& filter_str)
+{
     // Allocate and compile a parser based on the input string fn_str
-    m_map_fn_parser = std::make_unique<amrex::Parser>(
+    m_map_fn_parsers.push_back(std::make_unique<amrex::Parser>(
         utils::parser::makeParser(
-            fn_str, {"x", "y", "z", "ux", "uy", "uz"}));
-    m_map_fn = m_map_fn_parser->compile<6>();
+            fn_str, {"x", "y", "z", "ux", "uy", "uz"})));
+    m_h_map_fn.push_back(m_map_fn_parsers.back()->compile<6>());
     // Do the same for filter function, if it exists
-    if (m_do_filter) {
-        m_filter_fn_parser = std::make_unique<amrex::Parser>(
+    if (do_filter) {
+        m_filter_fn_parsers.push_back(std::make_unique<amrex::Parser>(
             utils::parser::makeParser(
-            filter_str, {"x", "y", "z", "ux", "uy", "uz"}));
-        m_filter_fn = m_filter_fn_parser->compile<6>();
+            filter_str, {"x", "y", "z", "ux", "uy", "uz"})));
+        m_h_filter_fn.push_back(m_filter_fn_parsers.back()->compile<6>());
+    } else {
+        m_h_filter_fn.emplace_back();
+    }
+    m_h_do_filter.push_back(do_filter ? 1 : 0);
+
+    // The averages without filter all divide by the same weight, so they share one
+    // component. Weight components are numbered after the reductions, see Compute.
+    int weight_comp = -1;
+    if (do_average) {
+        if (do_filter) {
+            weight_comp = m_nweights++;
+        } else {
+            if (m_unfiltered_weight_comp < 0) { m_unfiltered_weight_comp = m_nweights++; }
+            weight_comp = m_unfiltered_weight_comp;
+        }
     }
+    m_h_weight_comp.push_back(weight_comp);
+
+    return nReductions() - 1;
+}
+
+amrex::MultiFab const&
+ParticleReductionGroup::GetReductions ()
+{
+    // The deposited reductions are only reused for the same particles, at the same time.
+    // This does not rely on every functor of the group being called before the next output.
+    auto& warpx = WarpX::GetInstance();
+    const int step = warpx.getistep(m_lev);
+    const amrex::Real time = warpx.gett_new(m_lev);
+    const amrex::Long data_generation =
+        warpx.GetPartContainer().GetParticleContainer(m_ispec).DataGeneration();
+    if (!m_red_mf || step != m_step || time != m_time || data_generation != m_data_generation) {
+        Compute();
+        m_step = step;
+        m_time = time;
+        m_data_generation = data_generation;
+        m_nreleased = 0;
+    }
+    return *m_red_mf;
 }
 
 void
-ParticleReductionFunctor::operator() (amrex::MultiFab& mf_dst, const int dcomp, const int /*i_buffer*/) const
+ParticleReductionGroup::Release ()
+{
+    ++m_nreleased;
+    if (m_nreleased == nReductions()) {
+        m_red_mf.reset();
+        m_nreleased = 0;
+    }
+}
+
+void
+ParticleReductionGroup::Compute ()
 {
     auto& warpx = WarpX::GetInstance();
+    const int nred = nReductions();
+
+    // Copy the parser executors and the component indices to the device
+    m_d_map_fn.resize(nred);
+    m_d_filter_fn.resize(nred);
+    m_d_do_filter.resize(nred);
+    m_d_weight_comp.resize(nred);
+    amrex::Vector<int> h_weight_comp(nred);
+    for (int ir = 0; ir < nred; ++ir) {
+        h_weight_comp[ir] = (m_h_weight_comp[ir] >= 0) ? nred + m_h_weight_comp[ir] : -1;
+    }
+    amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, m_h_map_fn.begin(), m_h_map_fn.end(), m_d_map_fn.begin());
+    amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, m_h_filter_fn.begin(), m_h_filter_fn.end(), m_d_filter_fn.begin());
+    amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, m_h_do_filter.begin(), m_h_do_filter.end(), m_d_do_filter.begin());
+    amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, h_weight_comp.begin(), h_weight_comp.end(), m_d_weight_comp.begin());
+    amrex::Gpu::streamSynchronize();
+
     // Guard cell is set to 1 for generality. However, for a cell-centered
     // output Multifab, mf_dst, the guard-cell data is not needed especially considering
     // the operations performend in the CoarsenAndInterpolate function.
     constexpr int ng = 1;
-    // Temporary cell-centered, multi-component MultiFab for storing particles per cell.
-    amrex::MultiFab red_mf(warpx.boxArray(m_lev), warpx.DistributionMap(m_lev), 1, ng);
+    // Give back the reductions of a previous output that were not all read
+    m_red_mf.reset();
+    // Temporary cell-centered, multi-component MultiFab for storing the sums of all the
+    // reductions, followed by the sums of the weights needed for the averages.
+    m_red_mf = warpx.GetScratchPool().Get(warpx.boxArray(m_lev), warpx.DistributionMap(m_lev),
+                                          nred + m_nweights, amrex::IntVect(ng),
+                                          "ParticleReduction");
+    m_red_mf->setVal(0._rt);
     auto& pc = warpx.GetPartContainer().GetParticleContainer(m_ispec);
-    // Copy over member variables so they can be captured in the lambda
-    auto map_fn = m_map_fn;
-    auto filter_fn = m_filter_fn;
-    const bool do_filter = m_do_filter;
-    ParticleToMesh(pc, red_mf, m_lev,
+
+    const amrex::ParserExecutor<6>* map_fn = m_d_map_fn.dataPtr();
+    const amrex::ParserExecutor<6>* filter_fn = m_d_filter_fn.dataPtr();
+    const int* do_filter = m_d_do_filter.dataPtr();
+    const int* weight_comp = m_d_weight_comp.dataPtr();
+    ParticleToMesh(pc, *m_red_mf, m_lev,
             [=] AMREX_GPU_DEVICE (const WarpXParticleContainer::SuperParticleType& p,
                 amrex::Array4<amrex::Real> const& out_array,
                 amrex::GpuArray<amrex::Real,AMREX_SPACEDIM> const& plo,
@@ -78,53 +152,68 @@ ParticleReductionFunctor::operator() (amrex::MultiFab& mf_dst, const int dcomp,
                 const amrex::ParticleReal ux = p.rdata(PIdx::ux) / PhysConst::c;
                 const amrex::ParticleReal uy = p.rdata(PIdx::uy) / PhysConst::c;
                 const amrex::ParticleReal uz = p.rdata(PIdx::uz) / PhysConst::c;
-                const bool filtered_out_flag = ((do_filter) && (filter_fn(xw, yw, zw, ux, uy, uz) == 0.0_prt));
-                const amrex::Real value = (filtered_out_flag) ? (0._rt):(map_fn(xw, yw, zw, ux, uy, uz));
-                amrex::Gpu::Atomic::AddNoRet(&out_array(ii, jj, kk, 0), (amrex::Real)(p.rdata(PIdx::w) * value));
+                const amrex::ParticleReal w = p.rdata(PIdx::w);
+
+                // The weight shared by the unfiltered averages must only be added once
+                bool unfiltered_weight_done = false;
+                for (int ir = 0; ir < nred; ++ir) {
+                    const bool filtered_out_flag = (do_filter[ir] && (filter_fn[ir](xw, yw, zw, ux, uy, uz) == 0.0_prt));
+                    if (filtered_out_flag) { continue; }
+                    const amrex::Real value = map_fn[ir](xw, yw, zw, ux, uy, uz);
+                    amrex::Gpu::Atomic::AddNoRet(&out_array(ii, jj, kk, ir), (amrex::Real)(w * value));
+                    const int iw = weight_comp[ir];
+                    if (iw < 0 || (!do_filter[ir] && unfiltered_weight_done)) { continue; }
+                    amrex::Gpu::Atomic::AddNoRet(&out_array(ii, jj, kk, iw), (amrex::Real)(w));
+                    if (!do_filter[ir]) { unfiltered_weight_done = true; }
+                }
             });
-    if (m_do_average) {
-        amrex::MultiFab ppc_mf(warpx.boxArray(m_lev), warpx.DistributionMap(m_lev), 1, ng);
-        // Add the weight for each particle -- total number of particles of this species
-        ParticleToMesh(pc, ppc_mf, m_lev,
-                [=] AMREX_GPU_DEVICE (const WarpXParticleContainer::SuperParticleType& p,
-                    amrex::Array4<amrex::Real> const& out_array,
-                    amrex::GpuArray<amrex::Real,AMREX_SPACEDIM> const& plo,
-                    amrex::GpuArray<amrex::Real,AMREX_SPACEDIM> const& dxi)
-                {
-                    // Get position in WarpX convention to use in parser. Will be different from
-                    // p.pos() for 1D and 2D simulations.
-                    amrex::ParticleReal xw = 0._rt, yw = 0._rt, zw = 0._rt;
-                    get_particle_position(p, xw, yw, zw);
-
-                    // Get position in AMReX convention to calculate corresponding index.
-                    // Ideally this will be replaced with the AMReX NGP interpolator
-                    // Always do x direction. No RZ case because it's not implemented, and code
-                    // will have aborted
-                    const auto [ii, jj, kk] = amrex::getParticleCell(p, plo, dxi).dim3();
-
-                    // Fix dimensions since parser assumes u = gamma * v / c
-                    const amrex::ParticleReal ux = p.rdata(PIdx::ux) / PhysConst::c;
-                    const amrex::ParticleReal uy = p.rdata(PIdx::uy) / PhysConst::c;
-                    const amrex::ParticleReal uz = p.rdata(PIdx::uz) / PhysConst::c;
-                    amrex::Real filter;
-                    if ((do_filter) && (filter_fn(xw, yw, zw, ux, uy, uz) == 0._rt)) { filter = 0._rt;
-                    } else { filter = 1._rt; }
-                    amrex::Gpu::Atomic::AddNoRet(&out_array(ii, jj, kk, 0), (amrex::Real)(p.rdata(PIdx::w) * filter));
-                });
+
+    if (m_nweights > 0) {
         // Divide value by number of particles for average. Set average to zero if there are no particles
-        for (amrex::MFIter mfi(red_mf, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        for (amrex::MFIter mfi(*m_red_mf, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi)
         {
             const amrex::Box& box = mfi.tilebox();
-            amrex::Array4<amrex::Real> const& a_red = red_mf.array(mfi);
-            amrex::Array4<amrex::Real const> const& a_ppc = ppc_mf.const_array(mfi);
-            amrex::ParallelFor(box,
-                    [=] AMREX_GPU_DEVICE (int i, int j, int k) {
-                        if (a_ppc(i,j,k,0) == 0) { a_red(i,j,k,0) = 0;
-                        } else { a_red(i,j,k,0) = a_red(i,j,k,0) / a_ppc(i,j,k,0); }
+            amrex::Array4<amrex::Real> const& a_red = m_red_mf->array(mfi);
+            amrex::ParallelFor(box, nred,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) {
+                        const int iw = weight_comp[n];
+                        if (iw < 0) { return; }
+                        if (a_red(i,j,k,iw) == 0) { a_red(i,j,k,n) = 0;
+                        } else { a_red(i,j,k,n) = a_red(i,j,k,n) / a_red(i,j,k,iw); }
                     });
         }
     }
+}
+
+ParticleReductionFunctor::ParticleReductionFunctor (const amrex::MultiFab* mf_src, const int lev,
+        const amrex::IntVect crse_ratio, const std::string& fn_str,
+        const int ispec, const bool do_average,
+        const bool do_filter, const std::string& filter_str,
+        std::shared_ptr<ParticleReductionGroup> group, const int ncomp)
+    : ComputeDiagFunctor(ncomp, crse_ratio), m_group(std::move(group))
+{
+    // mf_src will not be used, let's make sure it's null.
+    AMREX_ALWAYS_ASSERT(mf_src == nullptr);
+    // Write only in one output component.
+    AMREX_ALWAYS_ASSERT(ncomp == 1);
+
+    if (!m_group) {
+        m_group = std::make_shared<ParticleReductionGroup>(lev, ispec);
+    }
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        m_group->lev() == lev && m_group->ispec() == ispec,
+        "ParticleReductionFunctor: the reduction group must be for the same level and species");
+    m_ireduction = m_group->AddReduction(fn_str, do_average, do_filter, filter_str);
+}
+
+void
+ParticleReductionFunctor::operator() (amrex::MultiFab& mf_dst, const int dcomp, const int /*i_buffer*/) const
+{
+    // The first functor of the group deposits all the reductions of the group
+    amrex::MultiFab const& red_mf = m_group->GetReductions();
+
+    // Coarsen and interpolate from red_mf to the output diagnostic MultiFab, mf_dst.
+    ablastr::coarsen::sample::Coarsen(mf_dst, red_mf, dcomp, m_ireduction, nComp(), 0, m_crse_ratio);
 
-    // Coarsen and interpolate from ppc_mf to the output diagnostic MultiFab, mf_dst.
-    ablastr::coarsen::sample::Coarsen(mf_dst, red_mf, dcomp, 0, nComp(), 0, m_crse_ratio);
+    m_group->Release();
 }
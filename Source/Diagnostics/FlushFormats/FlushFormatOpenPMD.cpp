@@ -53,11 +53,26 @@ FlushFormatOpenPMD::FlushFormatOpenPMD (const std::string& diag_name)
         throw std::runtime_error("BeamMonitor: groupBased encoding not supported for BP5.");
     }
 
+    // ADIOS2 engine type
+    std::string engine_type;
+    pp_diag_name.query("adios2_engine.type", engine_type);
+
     std::string diag_type_str;
     pp_diag_name.get("diag_type", diag_type_str);
+    // BTD through a staging engine: every buffer is streamed as a new step
+    // to a consumer that assembles the lab-frame snapshots. With variable-based
+    // encoding in an ADIOS2 file, the same steps are written to the file.
+    bool btd_streaming = false;
     if (diag_type_str == "BackTransformed")
     {
-        if ( ( openPMD::IterationEncoding::fileBased != encoding ) &&
+        btd_streaming = (openpmd_backend == "sst") || (engine_type == "sst") ||
+            ((openpmd_backend == "bp5" || openpmd_backend == "bp") &&
+             (encoding == openPMD::IterationEncoding::variableBased));
+        if (btd_streaming)
+        {
+            encoding = openPMD::IterationEncoding::variableBased;
+        }
+        else if ( ( openPMD::IterationEncoding::fileBased != encoding ) &&
             ( openPMD::IterationEncoding::groupBased != encoding ) )
         {
             const std::string warnMsg = diag_name+" Unable to support BTD with streaming. Using GroupBased ";
@@ -70,7 +85,7 @@ FlushFormatOpenPMD::FlushFormatOpenPMD (const std::string& diag_name)
     // if no encoding is defined, then check to see if tspf is defined.
     // (backward compatibility)
     //
-    if ( !encodingDefined )
+    if ( !encodingDefined && !btd_streaming )
     {
         bool openpmd_tspf = false;
         const bool tspfDefined = pp_diag_name.query("openpmd_tspf", openpmd_tspf);
@@ -95,9 +110,7 @@ FlushFormatOpenPMD::FlushFormatOpenPMD (const std::string& diag_name)
         operator_parameters.insert({k, v});
     }
 
-    // ADIOS2 engine type & parameters
-    std::string engine_type;
-    pp_diag_name.query("adios2_engine.type", engine_type);
+    // ADIOS2 engine parameters
     std::string const engine_prefix = diag_name + ".adios2_engine.parameters";
     const ParmParse ppe;
     auto eng_entr = amrex::ParmParse::getEntries(engine_prefix);
@@ -117,7 +130,8 @@ FlushFormatOpenPMD::FlushFormatOpenPMD (const std::string& diag_name)
         operator_type, operator_parameters,
         engine_type, engine_parameters,
         warpx.getPMLdirections(),
-        warpx.GetAuthors()
+        warpx.GetAuthors(),
+        btd_streaming
     );
 }
 
@@ -165,6 +179,10 @@ FlushFormatOpenPMD::WriteToFile (
         output_iteration = snapshotID;
     }
 
+    if( isBTD && m_OpenPMDPlotWriter->IsBTDStreaming() ) {
+        m_OpenPMDPlotWriter->SetBTDStreamStep(snapshotID, bufferID, numBuffers, isLastBTDFlush);
+    }
+
     // Set step and output directory name.
     m_OpenPMDPlotWriter->SetStep(output_iteration, prefix, file_min_digits, isBTD);
 
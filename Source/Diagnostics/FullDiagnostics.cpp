@@ -517,11 +517,13 @@ FullDiagnostics::InitializeFieldFunctorsRZopenPMD (int lev)
 
     // Generate field functors for every particle field diagnostic for every species in m_pfield_species.
     // The names of the diagnostics are output in the `[varname]_[species]` format.
+    // The functors of a species share a group, so that they are computed in one sweep over the particles.
+    const amrex::Vector<std::shared_ptr<ParticleReductionGroup>> reduction_groups = MakeParticleReductionGroups(lev);
     for (int pcomp=0; pcomp<int(m_pfield_varnames.size()); pcomp++) {
         for (int ispec=0; ispec<int(m_pfield_species.size()); ispec++) {
             m_all_field_functors[lev][nvar + pcomp * nspec + ispec] = std::make_unique<ParticleReductionFunctor>(nullptr,
                     lev, m_crse_ratio, m_pfield_strings[pcomp], m_pfield_species_index[ispec], m_pfield_do_average[pcomp],
-                    m_pfield_dofilter[pcomp], m_pfield_filter_strings[pcomp]);
+                    m_pfield_dofilter[pcomp], m_pfield_filter_strings[pcomp], reduction_groups[ispec]);
             if (update_varnames) {
                 AddRZModesToOutputNames(std::string(m_pfield_varnames[pcomp]) + "_" + std::string(m_pfield_species[ispec]), ncomp);
             }
@@ -788,6 +790,16 @@ FullDiagnostics::InitializeBufferData (int i_buffer, int lev, bool restart ) {
 }
 
 
+amrex::Vector<std::shared_ptr<ParticleReductionGroup>>
+FullDiagnostics::MakeParticleReductionGroups (int lev) const
+{
+    amrex::Vector<std::shared_ptr<ParticleReductionGroup>> reduction_groups;
+    for (int ispec=0; ispec<int(m_pfield_species.size()); ispec++) {
+        reduction_groups.push_back(std::make_shared<ParticleReductionGroup>(lev, m_pfield_species_index[ispec]));
+    }
+    return reduction_groups;
+}
+
 void
 FullDiagnostics::InitializeFieldFunctors (int lev)
 {
@@ -876,12 +888,14 @@ FullDiagnostics::InitializeFieldFunctors (int lev)
             WARPX_ABORT_WITH_MESSAGE(m_varnames[comp] + " is not a known field output type for this geometry");
         }
     }
-    // Add functors for average particle data for each species
+    // Add functors for average particle data for each species.
+    // The functors of a species share a group, so that they are computed in one sweep over the particles.
+    const amrex::Vector<std::shared_ptr<ParticleReductionGroup>> reduction_groups = MakeParticleReductionGroups(lev);
     for (int pcomp=0; pcomp<int(m_pfield_varnames.size()); pcomp++) {
         for (int ispec=0; ispec<int(m_pfield_species.size()); ispec++) {
             m_all_field_functors[lev][nvar + pcomp * nspec + ispec] = std::make_unique<ParticleReductionFunctor>(nullptr,
                     lev, m_crse_ratio, m_pfield_strings[pcomp], m_pfield_species_index[ispec], m_pfield_do_average[pcomp],
-                    m_pfield_dofilter[pcomp], m_pfield_filter_strings[pcomp]);
+                    m_pfield_dofilter[pcomp], m_pfield_filter_strings[pcomp], reduction_groups[ispec]);
         }
     }
     AddRZModesToDiags( lev );
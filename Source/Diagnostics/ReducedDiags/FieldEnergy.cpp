@@ -8,6 +8,7 @@
 #include "FieldEnergy.H"
 
 #include "Fields.H"
+#include "Diagnostics/ReducedDiags/FusedReductions.H"
 #include "Diagnostics/ReducedDiags/ReducedDiags.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXConst.H"
@@ -31,7 +32,6 @@
 #include <vector>
 
 using namespace amrex::literals;
-using warpx::fields::FieldType;
 
 // constructor
 FieldEnergy::FieldEnergy (const std::string& rd_name)
@@ -89,35 +89,36 @@ void FieldEnergy::ComputeDiags (int step)
     // get number of level
     int const nLevel = warpx.finestLevel() + 1;
 
-    using ablastr::fields::Direction;
+    // squared norms of [Ex, Ey, Ez, Bx, By, Bz] at each level
+    std::vector<amrex::Real> norm2(6*nLevel);
+
+    // computed and reduced over the MPI ranks by MultiReducedDiags,
+    // together with the other reduced diagnostics due at this step
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        m_fused_reductions && m_fused_reductions->HasFieldNorms(step),
+        "FieldEnergy: the fused field norms of this step were not computed by MultiReducedDiags");
+    for (int lev = 0; lev < nLevel; ++lev) {
+        for (int dir = 0; dir < 3; ++dir) {
+            norm2[6*lev + dir] = m_fused_reductions->GetFieldNorm2(lev, false, dir);
+            norm2[6*lev + 3 + dir] = m_fused_reductions->GetFieldNorm2(lev, true, dir);
+        }
+    }
 
     // loop over refinement levels
     for (int lev = 0; lev < nLevel; ++lev)
     {
-        // get MultiFab data at lev
-        amrex::MultiFab const & Ex = *warpx.m_fields.get(FieldType::Efield_aux, Direction{0}, lev);
-        amrex::MultiFab const & Ey = *warpx.m_fields.get(FieldType::Efield_aux, Direction{1}, lev);
-        amrex::MultiFab const & Ez = *warpx.m_fields.get(FieldType::Efield_aux, Direction{2}, lev);
-        amrex::MultiFab const & Bx = *warpx.m_fields.get(FieldType::Bfield_aux, Direction{0}, lev);
-        amrex::MultiFab const & By = *warpx.m_fields.get(FieldType::Bfield_aux, Direction{1}, lev);
-        amrex::MultiFab const & Bz = *warpx.m_fields.get(FieldType::Bfield_aux, Direction{2}, lev);
-
         // get cell volume
         std::array<amrex::Real, 3> const &dx = WarpX::CellSize(lev);
         amrex::Real const dV = dx[0]*dx[1]*dx[2];
 
-        // compute E squared
-        amrex::Real const tmpEx = ComputeNorm2(Ex, lev);
-        amrex::Real const tmpEy = ComputeNorm2(Ey, lev);
-        amrex::Real const tmpEz = ComputeNorm2(Ez, lev);
-
-        // compute B squared
-        amrex::Real const tmpBx = ComputeNorm2(Bx, lev);
-        amrex::Real const tmpBy = ComputeNorm2(By, lev);
-        amrex::Real const tmpBz = ComputeNorm2(Bz, lev);
-
-        amrex::Real const Es = tmpEx + tmpEy + tmpEz;
-        amrex::Real const Bs = tmpBx + tmpBy + tmpBz;
+        amrex::Real Es = 0._rt;
+        amrex::Real Bs = 0._rt;
+        for (int dir = 0; dir < 3; ++dir) {
+            // compute E squared
+            Es += norm2[6*lev + dir];
+            // compute B squared
+            Bs += norm2[6*lev + 3 + dir];
+        }
 
         constexpr int noutputs = 3; // total energy, E-field energy and B-field energy
         constexpr int index_total = 0;
@@ -147,7 +148,16 @@ void FieldEnergy::ComputeDiags (int step)
 // This takes into account the fraction of the cell volumes within the domain
 // and the cell volumes in cylindrical coordinates.
 amrex::Real
-FieldEnergy::ComputeNorm2(amrex::MultiFab const& field, [[maybe_unused]]int lev)
+FieldEnergy::ComputeNorm2(amrex::MultiFab const& field, int lev)
+{
+    amrex::Real result = ComputeNorm2Local(field, lev);
+    amrex::ParallelDescriptor::ReduceRealSum(result);
+
+    return result;
+}
+
+amrex::Real
+FieldEnergy::ComputeNorm2Local(amrex::MultiFab const& field, [[maybe_unused]]int lev)
 {
     amrex::IntVect const is_nodal = field.ixType().toIntVect();
 
@@ -218,8 +228,5 @@ FieldEnergy::ComputeNorm2(amrex::MultiFab const& field, [[maybe_unused]]int lev)
 
     }
 
-    amrex::Real result = amrex::get<0>(reduce_data.value());
-    amrex::ParallelDescriptor::ReduceRealSum(result);
-
-    return result;
+    return amrex::get<0>(reduce_data.value());
 }
@@ -43,6 +43,7 @@
 #include <ostream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 using namespace amrex;
@@ -140,6 +141,12 @@ FieldProbe::FieldProbe (const std::string& rd_name)
     pp_rd_name.query("integrate", m_field_probe_integrate);
     utils::parser::queryWithParser(pp_rd_name, "interp_order", interp_order);
     pp_rd_name.query("do_moving_window_FP", do_moving_window_FP);
+    utils::parser::queryWithParser(pp_rd_name, "buffer_steps", m_buffer_steps);
+    utils::parser::queryWithParser(pp_rd_name, "decimation", m_decimation);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_buffer_steps >= 1,
+                                     "Field probe buffer_steps must be at least 1");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_decimation >= 1,
+                                     "Field probe decimation must be at least 1");
 
     bool raw_fields;
     const bool raw_fields_specified = pp_rd_name.query("raw_fields", raw_fields);
@@ -371,19 +378,31 @@ bool FieldProbe::ProbeInDomain () const
 
 void FieldProbe::ComputeDiags (int step)
 {
+    // get a reference to WarpX instance
+    auto & warpx = WarpX::GetInstance();
+
+    // Gather the data of the samples sent at the previous step, whose sizes have arrived
+    PostDataGather();
+
     // Judge if the diags should be done
     if (!m_field_probe_integrate)
     {
         if (!m_intervals.contains(step+1)) { return; }
     }
-    // get a reference to WarpX instance
-    auto & warpx = WarpX::GetInstance();
 
     // get number of mesh-refinement levels
     const auto nLevel = warpx.finestLevel() + 1;
 
     using ablastr::fields::Direction;
 
+    // With decimation, the instantaneous values are averaged over m_decimation output
+    // steps on device, and only the last of these steps is packed and sent to the IO rank
+    const bool is_output_step = m_intervals.contains(step+1);
+    const bool first_in_average = (m_decimation_count == 0);
+    const bool pack_sample = is_output_step && (m_decimation_count + 1 == m_decimation);
+    const amrex::ParticleReal average_weight = 1._prt / static_cast<amrex::ParticleReal>(m_decimation);
+    const auto size_before_sample = m_data.size();
+
     // loop over refinement levels
     for (int lev = 0; lev < nLevel; ++lev)
     {
@@ -429,12 +448,10 @@ void FieldProbe::ComputeDiags (int step)
             numparticles += pti.numParticles();
         }
 
-        if (m_intervals.contains(step+1))
+        if (pack_sample)
         {
-            // reset m_data vector to clear pushed values. Reserves data
-            m_data.clear();
-            m_data.shrink_to_fit();
-            m_data.reserve(numparticles * noutputs);
+            // m_data keeps the previous buffered samples. Reserves data
+            m_data.reserve(m_data.size() + numparticles * noutputs);
         }
 
         for (MyParIter pti(m_probe, lev); pti.isValid(); ++pti)
@@ -500,6 +517,7 @@ void FieldProbe::ComputeDiags (int step)
                 const int temp_modes = WarpX::n_rz_azimuthal_modes;
                 const int temp_interp_order = interp_order;
                 const bool temp_field_probe_integrate = m_field_probe_integrate;
+                const bool temp_first_in_average = first_in_average;
 
                 // Interpolating to the probe positions for each particle
                 amrex::ParallelFor( np, [=] AMREX_GPU_DEVICE (long ip)
@@ -540,20 +558,31 @@ void FieldProbe::ComputeDiags (int step)
                         part_Bz[ip] += Bzp * dt; //remember to add lorentz transform
                         part_S[ip] += S * dt; //remember to add lorentz transform
                     }
+                    else if (temp_first_in_average)
+                    {
+                        part_Ex[ip] = Exp * average_weight; //remember to add lorentz transform
+                        part_Ey[ip] = Eyp * average_weight; //remember to add lorentz transform
+                        part_Ez[ip] = Ezp * average_weight; //remember to add lorentz transform
+                        part_Bx[ip] = Bxp * average_weight; //remember to add lorentz transform
+                        part_By[ip] = Byp * average_weight; //remember to add lorentz transform
+                        part_Bz[ip] = Bzp * average_weight; //remember to add lorentz transform
+                        part_S[ip] = S * average_weight; //remember to add lorentz transform
+                    }
                     else
                     {
-                        part_Ex[ip] = Exp; //remember to add lorentz transform
-                        part_Ey[ip] = Eyp; //remember to add lorentz transform
-                        part_Ez[ip] = Ezp; //remember to add lorentz transform
-                        part_Bx[ip] = Bxp; //remember to add lorentz transform
-                        part_By[ip] = Byp; //remember to add lorentz transform
-                        part_Bz[ip] = Bzp; //remember to add lorentz transform
-                        part_S[ip] = S; //remember to add lorentz transform
+                        // accumulate the average of the decimated samples
+                        part_Ex[ip] += Exp * average_weight;
+                        part_Ey[ip] += Eyp * average_weight;
+                        part_Ez[ip] += Ezp * average_weight;
+                        part_Bx[ip] += Bxp * average_weight;
+                        part_By[ip] += Byp * average_weight;
+                        part_Bz[ip] += Bzp * average_weight;
+                        part_S[ip] += S * average_weight;
                     }
                 });// ParallelFor Close
                 // this check is here because for m_field_probe_integrate == True, we always compute
                 // but we only write when we truly are in an output interval step
-                if (m_intervals.contains(step+1) && np > 0)
+                if (pack_sample && np > 0)
                 {
                     // This could be optimized by using shared memory.
                     amrex::Gpu::DeviceVector<amrex::Real> dv(np*noutputs);
@@ -586,103 +615,206 @@ void FieldProbe::ComputeDiags (int step)
             }
         } // end particle iterator loop
 
-        if (m_intervals.contains(step+1))
-        {
-            // returns total number of mpi notes into mpisize
-            const int mpisize = ParallelDescriptor::NProcs();
+    }// end loop over refinement levels
 
-            // allocates data space for length_array. Will contain size of m_data from each processor
-            amrex::Vector<int> length_vector;
-            amrex::Vector<int> localsize;
+    if (is_output_step)
+    {
+        m_decimation_count = (m_decimation_count + 1) % m_decimation;
+    }
+    if (pack_sample)
+    {
+        // all the ranks record the sample, even without probe particles
+        m_sample_steps.push_back(step + 1);
+        m_sample_times.push_back(warpx.gett_new(0));
+        m_sample_sizes.push_back(static_cast<int>(m_data.size() - size_before_sample));
+    }
 
-            if (amrex::ParallelDescriptor::IOProcessor()) {
-                length_vector.resize(mpisize, 0);
-            }
-            localsize.resize(1, static_cast<int>(m_data.size()));
-
-            // gather size of m_data from each processor
-            amrex::ParallelDescriptor::Gather(localsize.data(), 1,
-                                              length_vector.data(), 1,
-                                              amrex::ParallelDescriptor::IOProcessorNumber());
-
-            // IO processor sums values from length_array to get size of total output array.
-            /* displs records the size of each m_data as well as previous displs. This array
-             * tells Gatherv where in the m_data_out array allocation to write incoming data. */
-            long total_data_size = 0;
-            amrex::Vector<int> displs_vector;
-            if (amrex::ParallelDescriptor::IOProcessor()) {
-                displs_vector.assign(mpisize, 0);
-                total_data_size += length_vector[0];
-                for (int i=1; i<mpisize; i++) {
-                    displs_vector[i] = (displs_vector[i-1] + length_vector[i-1]);
-                    total_data_size += length_vector[i];
-                }
-                // valid particles are counted (for all MPI ranks) to inform output processes as to size of output
-                m_valid_particles = total_data_size / noutputs;
-                m_data_out.resize(total_data_size, 0);
-            }
-            // resize receive buffer (resize, initialize 0)
-            // gather m_data of varied lengths from all processors. Prints to m_data_out
-            amrex::ParallelDescriptor::Gatherv(m_data.data(), localsize[0],
-                                               m_data_out.data(), length_vector, displs_vector,
-                                               amrex::ParallelDescriptor::IOProcessorNumber());
-        }
-    }// end loop over refinement levels
-    // make sure data is in m_data on the IOProcessor
+    // Send the buffered samples to the IO rank when the buffer is full. The remaining
+    // samples are sent by Flush, when the time loop returns.
     // TODO: In the future, we want to use a parallel I/O method instead (plotfiles or openPMD)
+    if (static_cast<int>(m_sample_steps.size()) >= m_buffer_steps)
+    {
+        FlushSamples(m_buffer_steps == 1);
+    }
     m_last_compute_step = step;
 } // end void FieldProbe::ComputeDiags
 
-void FieldProbe::WriteToFile (int step) const
+void FieldProbe::Flush ()
 {
-    if (!(ProbeInDomain() && amrex::ParallelDescriptor::IOProcessor())) { return; }
+    FlushSamples(true);
+}
+
+void FieldProbe::FlushSamples (bool wait)
+{
+    // the buffers of the previous gather are reused, so it must complete first
+    CompletePendingGather();
 
-    // loop over num valid particles to find the lowest particle ID for later sorting
-    auto first_id = static_cast<long int>(m_data_out[0]);
-    for (long int i = 0; i < m_valid_particles; i++)
+    const int nsamples = static_cast<int>(m_sample_steps.size());
+    if (nsamples > 0)
     {
-        if (m_data_out[i*noutputs] < first_id) {
-            first_id = static_cast<long int>(m_data_out[i*noutputs]);
+        // returns total number of mpi notes into mpisize
+        const int mpisize = ParallelDescriptor::NProcs();
+
+        // the sent sizes and data must be kept until the gathers complete
+        m_send_sizes = std::move(m_sample_sizes);
+        m_send_buffer = std::move(m_data);
+        m_data.clear();
+        if (ParallelDescriptor::IOProcessor()) {
+            m_pending_sizes.resize(mpisize * nsamples, 0);
+            m_pending_steps = m_sample_steps;
+            m_pending_times = m_sample_times;
         }
+
+        // Gather the size of each buffered sample from each processor, without
+        // blocking. The IO rank needs them to receive the data, which is thus
+        // gathered later, by PostDataGather.
+#ifdef AMREX_USE_MPI
+        MPI_Datatype const mpi_int = ParallelDescriptor::Mpi_typemap<int>::type();
+        MPI_Igather(m_send_sizes.data(), nsamples, mpi_int,
+                    m_pending_sizes.data(), nsamples, mpi_int,
+                    ParallelDescriptor::IOProcessorNumber(), ParallelDescriptor::Communicator(),
+                    &m_sizes_request);
+#else
+        m_pending_sizes = m_send_sizes;
+#endif
+        m_sizes_pending = true;
+
+        m_sample_steps.clear();
+        m_sample_times.clear();
+        m_sample_sizes.clear();
     }
 
-    // Create a new array to store probe data ordered by id, which will be printed to file.
-    amrex::Vector<amrex::Real> sorted_data;
-    sorted_data.resize(m_data_out.size());
+    if (wait) { CompletePendingGather(); }
+}
 
-    // loop over num valid particles and write data into the appropriately
-    // sorted location
-    for (long int i = 0; i < m_valid_particles; i++)
-    {
-        const long int idx = static_cast<long int>(m_data_out[i*noutputs]) - first_id;
-        for (long int k = 0; k < noutputs; k++)
-        {
-            sorted_data[idx * noutputs + k] = m_data_out[i * noutputs + k];
+void FieldProbe::PostDataGather ()
+{
+    if (!m_sizes_pending) { return; }
+#ifdef AMREX_USE_MPI
+    MPI_Wait(&m_sizes_request, MPI_STATUS_IGNORE);
+#endif
+    m_sizes_pending = false;
+
+    const int mpisize = ParallelDescriptor::NProcs();
+    const int io_proc = ParallelDescriptor::IOProcessorNumber();
+    const auto nsamples = static_cast<int>(m_send_sizes.size());
+
+    // IO processor sums the sizes from each processor to get size of total output array.
+    /* displs records the size of each m_data as well as previous displs. This array
+     * tells Gatherv where in the m_data_out array allocation to write incoming data. */
+    if (ParallelDescriptor::IOProcessor()) {
+        m_gather_counts.assign(mpisize, 0);
+        m_gather_displs.assign(mpisize, 0);
+        for (int i = 0; i < mpisize; i++) {
+            for (int isample = 0; isample < nsamples; isample++) {
+                m_gather_counts[i] += m_pending_sizes[i*nsamples + isample];
+            }
+            if (i > 0) { m_gather_displs[i] = m_gather_displs[i-1] + m_gather_counts[i-1]; }
         }
+        m_data_out.resize(m_gather_displs[mpisize-1] + m_gather_counts[mpisize-1], 0);
     }
 
+    const auto localsize = static_cast<int>(m_send_buffer.size());
+#ifdef AMREX_USE_MPI
+    MPI_Datatype const mpi_type = ParallelDescriptor::Mpi_typemap<amrex::Real>::type();
+    MPI_Igatherv(m_send_buffer.data(), localsize, mpi_type,
+                 m_data_out.data(), m_gather_counts.data(), m_gather_displs.data(), mpi_type,
+                 io_proc, ParallelDescriptor::Communicator(), &m_gather_request);
+#else
+    amrex::ignore_unused(io_proc, localsize);
+    m_data_out = m_send_buffer;
+#endif
+    m_gather_pending = true;
+}
+
+void FieldProbe::CompletePendingGather ()
+{
+    PostDataGather();
+    if (!m_gather_pending) { return; }
+#ifdef AMREX_USE_MPI
+    MPI_Wait(&m_gather_request, MPI_STATUS_IGNORE);
+#endif
+    m_gather_pending = false;
+    m_send_sizes.clear();
+    m_send_buffer.clear();
+    WriteSamples();
+}
+
+void FieldProbe::WriteSamples () const
+{
+    if (!(ProbeInDomain() && amrex::ParallelDescriptor::IOProcessor())) { return; }
+
+    const int mpisize = ParallelDescriptor::NProcs();
+    const auto nsamples = static_cast<int>(m_pending_steps.size());
+
+    // position of the next sample of each processor in m_data_out
+    amrex::Vector<long> rank_offset(m_gather_displs.begin(), m_gather_displs.end());
+
     // open file
     std::ofstream ofs{m_path + m_rd_name + "." + m_extension,
                         std::ofstream::out | std::ofstream::app};
 
-    // loop over num valid particles and write
-    for (long int i = 0; i < m_valid_particles; i++)
+    amrex::Vector<amrex::Real> sample_data;
+    amrex::Vector<amrex::Real> sorted_data;
+    for (int isample = 0; isample < nsamples; isample++)
     {
-        ofs << std::fixed << std::defaultfloat;
-        ofs << step + 1;
-        ofs << m_sep;
-        ofs << std::fixed << std::setprecision(14) << std::scientific;
-        // write time
-        ofs << WarpX::GetInstance().gett_new(0);
-
-        // start at k = 1 since the particle id is not written to file
-        for (int k = 1; k < noutputs; k++)
+        // collect the data of this sample from all the processors
+        sample_data.clear();
+        for (int i = 0; i < mpisize; i++)
         {
-            ofs << m_sep;
-            ofs << sorted_data[i * noutputs + k];
+            const int size = m_pending_sizes[i*nsamples + isample];
+            sample_data.insert(sample_data.end(),
+                               m_data_out.begin() + rank_offset[i],
+                               m_data_out.begin() + rank_offset[i] + size);
+            rank_offset[i] += size;
         }
-        ofs << "\n";
-    } // end loop over data size
+
+        // valid particles are counted (for all MPI ranks)
+        const auto valid_particles = static_cast<long int>(sample_data.size()) / noutputs;
+        if (valid_particles == 0) { continue; }
+
+        // loop over num valid particles to find the lowest particle ID for later sorting
+        auto first_id = static_cast<long int>(sample_data[0]);
+        for (long int i = 0; i < valid_particles; i++)
+        {
+            if (sample_data[i*noutputs] < first_id) {
+                first_id = static_cast<long int>(sample_data[i*noutputs]);
+            }
+        }
+
+        // Create a new array to store probe data ordered by id, which will be printed to file.
+        sorted_data.resize(sample_data.size());
+
+        // loop over num valid particles and write data into the appropriately
+        // sorted location
+        for (long int i = 0; i < valid_particles; i++)
+        {
+            const long int idx = static_cast<long int>(sample_data[i*noutputs]) - first_id;
+            for (long int k = 0; k < noutputs; k++)
+            {
+                sorted_data[idx * noutputs + k] = sample_data[i * noutputs + k];
+            }
+        }
+
+        // loop over num valid particles and write
+        for (long int i = 0; i < valid_particles; i++)
+        {
+            ofs << std::fixed << std::defaultfloat;
+            ofs << m_pending_steps[isample];
+            ofs << m_sep;
+            ofs << std::fixed << std::setprecision(14) << std::scientific;
+            // write time
+            ofs << m_pending_times[isample];
+
+            // start at k = 1 since the particle id is not written to file
+            for (int k = 1; k < noutputs; k++)
+            {
+                ofs << m_sep;
+                ofs << sorted_data[i * noutputs + k];
+            }
+            ofs << "\n";
+        } // end loop over data size
+    } // end loop over samples
     // close file
     ofs.close();
 }
@@ -0,0 +1,152 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "FusedReductions.H"
+
+#include "FieldEnergy.H"
+#include "Fields.H"
+#include "Particles/Algorithms/KineticEnergy.H"
+#include "Particles/MultiParticleContainer.H"
+#include "Particles/SpeciesPhysicalProperties.H"
+#include "Particles/WarpXParticleContainer.H"
+#include "Utils/WarpXConst.H"
+#include "Utils/WarpXProfilerWrapper.H"
+#include "WarpX.H"
+
+#include <ablastr/fields/MultiFabRegister.H>
+
+#include <AMReX_GpuQualifiers.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParticleReduce.H>
+#include <AMReX_Particles.H>
+#include <AMReX_REAL.H>
+#include <AMReX_Reduce.H>
+#include <AMReX_Tuple.H>
+
+#include <initializer_list>
+#include <vector>
+
+using namespace amrex;
+using warpx::fields::FieldType;
+
+void FusedReductions::Compute (int step, bool do_particle_moments, bool do_field_norms)
+{
+    WARPX_PROFILE("FusedReductions::Compute()");
+
+    Clear();
+
+    if (!do_particle_moments && !do_field_norms) { return; }
+
+    auto const & warpx = WarpX::GetInstance();
+
+    // all the local results are packed in this buffer,
+    // so that a single MPI reduction is needed
+    std::vector<double> buffer;
+
+    constexpr int n_moments = 6;
+    int nSpecies = 0;
+    if (do_particle_moments)
+    {
+        const auto & mypc = warpx.GetPartContainer();
+        nSpecies = mypc.nSpecies();
+        buffer.reserve(n_moments*nSpecies);
+
+        for (int i_s = 0; i_s < nSpecies; ++i_s)
+        {
+            const auto & myspc = mypc.GetParticleContainer(i_s);
+
+            const bool is_photon = myspc.AmIA<PhysicalSpecies::photon>();
+            // photons have zero mass, but ux, uy, uz are calculated assuming
+            // a mass equal to the electron mass
+            const amrex::Real m = is_photon ? PhysConst::m_e : myspc.getMass();
+
+            using PType = typename WarpXParticleContainer::SuperParticleType;
+
+            // One sweep over the particles computes all the moments at once:
+            // the result r is the tuple (Ws, Etot, Px, Py, Pz)
+            amrex::ReduceOps<ReduceOpSum, ReduceOpSum, ReduceOpSum, ReduceOpSum, ReduceOpSum> reduce_ops;
+            auto r = amrex::ParticleReduce<amrex::ReduceData<Real, Real, Real, Real, Real>>(
+                myspc,
+                [=] AMREX_GPU_DEVICE(const PType& p) noexcept
+                    -> amrex::GpuTuple<Real, Real, Real, Real, Real>
+                {
+                    const amrex::Real w  = p.rdata(PIdx::w);
+                    const amrex::Real ux = p.rdata(PIdx::ux);
+                    const amrex::Real uy = p.rdata(PIdx::uy);
+                    const amrex::Real uz = p.rdata(PIdx::uz);
+                    const amrex::Real kinetic_energy = is_photon ?
+                        Algorithms::KineticEnergyPhotons(ux,uy,uz) :
+                        Algorithms::KineticEnergy(ux,uy,uz,m);
+                    return {w, w*kinetic_energy, w*m*ux, w*m*uy, w*m*uz};
+                },
+                reduce_ops);
+
+            buffer.push_back(amrex::get<0>(r));
+            buffer.push_back(amrex::get<1>(r));
+            buffer.push_back(amrex::get<2>(r));
+            buffer.push_back(amrex::get<3>(r));
+            buffer.push_back(amrex::get<4>(r));
+            buffer.push_back(static_cast<double>(myspc.TotalNumberOfParticles(true, true)));
+        }
+    }
+
+    const int nLevel = warpx.finestLevel() + 1;
+    const auto field_offset = static_cast<int>(buffer.size());
+    if (do_field_norms)
+    {
+        using ablastr::fields::Direction;
+
+        for (int lev = 0; lev < nLevel; ++lev)
+        {
+            for (auto const field : {FieldType::Efield_aux, FieldType::Bfield_aux})
+            {
+                for (int dir = 0; dir < 3; ++dir)
+                {
+                    amrex::MultiFab const & mf = *warpx.m_fields.get(field, Direction{dir}, lev);
+                    buffer.push_back(FieldEnergy::ComputeNorm2Local(mf, lev));
+                }
+            }
+        }
+    }
+
+    // Reduced sum over MPI ranks, for all diagnostics at once
+    ParallelDescriptor::ReduceRealSum(buffer.data(), static_cast<int>(buffer.size()));
+
+    if (do_particle_moments)
+    {
+        m_species_moments.resize(nSpecies);
+        for (int i_s = 0; i_s < nSpecies; ++i_s)
+        {
+            auto & moments = m_species_moments[i_s];
+            double const * const b = buffer.data() + n_moments*i_s;
+            moments.weight = static_cast<amrex::Real>(b[0]);
+            moments.energy = static_cast<amrex::Real>(b[1]);
+            moments.px = static_cast<amrex::Real>(b[2]);
+            moments.py = static_cast<amrex::Real>(b[3]);
+            moments.pz = static_cast<amrex::Real>(b[4]);
+            moments.np = static_cast<amrex::Real>(b[5]);
+        }
+        m_particle_step = step;
+        m_has_particle_moments = true;
+    }
+
+    if (do_field_norms)
+    {
+        m_field_norm2.resize(6*nLevel);
+        for (int i = 0; i < 6*nLevel; ++i) {
+            m_field_norm2[i] = static_cast<amrex::Real>(buffer[field_offset + i]);
+        }
+        m_field_step = step;
+        m_has_field_norms = true;
+    }
+}
+
+void FusedReductions::Clear ()
+{
+    m_has_particle_moments = false;
+    m_has_field_norms = false;
+}
@@ -94,6 +94,11 @@ MultiReducedDiags::MultiReducedDiags ()
             return reduced_diags_dictionary.at(rd_type)(rd_name);
         });
     // end loop over all reduced diags
+
+    // share the step-local moments with all reduced diags
+    for (auto& rd : m_multi_rd) {
+        rd->m_fused_reductions = &m_fused_reductions;
+    }
 }
 // end constructor
 
@@ -119,12 +124,27 @@ void MultiReducedDiags::ComputeDiags (int step)
 {
     WARPX_PROFILE("MultiReducedDiags::ComputeDiags()");
 
+    // plan the diagnostics due at this step together: the quantities that
+    // several of them need are computed once, with a single MPI reduction
+    bool do_particle_moments = false;
+    bool do_field_norms = false;
+    for (auto const& rd : m_multi_rd)
+    {
+        if (!rd->DoDiags(step)) { continue; }
+        do_particle_moments = do_particle_moments || rd->UsesFusedParticleMoments();
+        do_field_norms = do_field_norms || rd->UsesFusedFieldNorms();
+    }
+    m_fused_reductions.Compute(step, do_particle_moments, do_field_norms);
+
     // loop over all reduced diags
     for (int i_rd = 0; i_rd < static_cast<int>(m_rd_names.size()); ++i_rd)
     {
         m_multi_rd[i_rd] -> ComputeDiags(step);
     }
     // end loop over all reduced diags
+
+    // the moments are only valid for this call
+    m_fused_reductions.Clear();
 }
 // end void MultiReducedDiags::ComputeDiags
 
@@ -161,6 +181,20 @@ void MultiReducedDiags::WriteToFile (int step)
 }
 // end void MultiReducedDiags::WriteToFile
 
+// write out the buffered data of all reduced diags
+void MultiReducedDiags::Flush ()
+{
+    WARPX_PROFILE("MultiReducedDiags::Flush()");
+
+    // loop over all reduced diags
+    for (int i_rd = 0; i_rd < static_cast<int>(m_rd_names.size()); ++i_rd)
+    {
+        m_multi_rd[i_rd] -> Flush();
+    }
+    // end loop over all reduced diags
+}
+// end void MultiReducedDiags::Flush
+
 // Check if any diagnostics will be done
 bool MultiReducedDiags::DoDiags(int step)
 {
@@ -7,20 +7,16 @@
 
 #include "ParticleMomentum.H"
 
+#include "Diagnostics/ReducedDiags/FusedReductions.H"
 #include "Particles/MultiParticleContainer.H"
-#include "Particles/SpeciesPhysicalProperties.H"
 #include "Particles/WarpXParticleContainer.H"
-#include "Utils/WarpXConst.H"
+#include "Utils/TextMsg.H"
 #include "WarpX.H"
 
-#include <AMReX_GpuQualifiers.H>
 #include <AMReX_PODVector.H>
 #include <AMReX_ParallelDescriptor.H>
-#include <AMReX_ParticleReduce.H>
 #include <AMReX_Particles.H>
 #include <AMReX_REAL.H>
-#include <AMReX_Reduce.H>
-#include <AMReX_Tuple.H>
 #include <AMReX_Vector.H>
 
 #include <algorithm>
@@ -124,44 +120,23 @@ void ParticleMomentum::ComputeDiags (int step)
     // Get number of species
     const int nSpecies = mypc.nSpecies();
 
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        m_fused_reductions && m_fused_reductions->HasParticleMoments(step),
+        "ParticleMomentum: the fused particle moments of this step were not computed by MultiReducedDiags");
+
     amrex::Real Wtot = 0.0_rt;
 
     // Loop over species
     for (int i_s = 0; i_s < nSpecies; ++i_s)
     {
-        // Get WarpXParticleContainer class object
-        const auto & myspc = mypc.GetParticleContainer(i_s);
-
-        // Get mass
-        // (photons must be treated as a special case: they have zero mass,
-        // but ux, uy, uz are calculated assuming a mass equal to the electron mass)
-        const amrex::Real m = (myspc.AmIA<PhysicalSpecies::photon>()) ? PhysConst::m_e : myspc.getMass();
-
-        using PType = typename WarpXParticleContainer::SuperParticleType;
-
-        // Use amrex::ParticleReduce to compute the sum of the momenta and weights of all particles
-        // held by the current MPI rank for this species (loop over all boxes held by this MPI rank):
-        // the result r is the tuple (Px, Py, Pz, Ws)
-        amrex::ReduceOps<ReduceOpSum, ReduceOpSum, ReduceOpSum, ReduceOpSum> reduce_ops;
-        auto r = amrex::ParticleReduce<amrex::ReduceData<Real, Real, Real, Real>>(
-            myspc,
-            [=] AMREX_GPU_DEVICE(const PType& p) noexcept -> amrex::GpuTuple<Real, Real, Real, Real>
-            {
-                const amrex::Real w  = p.rdata(PIdx::w);
-                const amrex::Real ux = p.rdata(PIdx::ux);
-                const amrex::Real uy = p.rdata(PIdx::uy);
-                const amrex::Real uz = p.rdata(PIdx::uz);
-                return {w*m*ux, w*m*uy, w*m*uz, w};
-            },
-            reduce_ops);
-
-        amrex::Real Px = amrex::get<0>(r);
-        amrex::Real Py = amrex::get<1>(r);
-        amrex::Real Pz = amrex::get<2>(r);
-        amrex::Real Ws = amrex::get<3>(r);
-
-        // Reduced sum over MPI ranks
-        ParallelDescriptor::ReduceRealSum({Px,Py,Pz,Ws}, ParallelDescriptor::IOProcessorNumber());
+        // Sums over the particles of this species, computed and reduced over the MPI ranks
+        // by MultiReducedDiags together with the other reduced diags due at this step
+        // (photons use the electron mass, since ux, uy, uz are normalized with it)
+        auto const & moments = m_fused_reductions->GetSpeciesMoments(i_s);
+        const amrex::Real Px = moments.px;
+        const amrex::Real Py = moments.py;
+        const amrex::Real Pz = moments.pz;
+        const amrex::Real Ws = moments.weight;
 
         // Accumulate sum of weights over all species (must come after MPI reduction of Ws)
         Wtot += Ws;
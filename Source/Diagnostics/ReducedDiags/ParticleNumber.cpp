@@ -8,8 +8,10 @@
 #include "ParticleNumber.H"
 
 #include "Diagnostics/ReducedDiags/ReducedDiags.H"
+#include "Diagnostics/ReducedDiags/FusedReductions.H"
 #include "Particles/MultiParticleContainer.H"
 #include "Particles/WarpXParticleContainer.H"
+#include "Utils/TextMsg.H"
 #include "WarpX.H"
 
 #include <AMReX_GpuQualifiers.H>
@@ -108,17 +110,22 @@ void ParticleNumber::ComputeDiags (int step)
     m_data[idx_total_macroparticles] = 0.0_rt;
     m_data[idx_total_sum_weight] = 0.0_rt;
 
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        m_fused_reductions && m_fused_reductions->HasParticleMoments(step),
+        "ParticleNumber: the fused particle moments of this step were not computed by MultiReducedDiags");
+
     // loop over species
     for (int i_s = 0; i_s < nSpecies; ++i_s)
     {
-        // get WarpXParticleContainer class object
-        auto & myspc = mypc.GetParticleContainer(i_s);
+        // Computed and reduced over the MPI ranks by MultiReducedDiags
+        // together with the other reduced diags due at this step
+        auto const & moments = m_fused_reductions->GetSpeciesMoments(i_s);
 
         // Save total number of macroparticles for this species
-        m_data[idx_first_species_macroparticles + i_s] = myspc.TotalNumberOfParticles();
+        m_data[idx_first_species_macroparticles + i_s] = moments.np;
 
         // Save sum of particles weight for this species
-        m_data[idx_first_species_sum_weight + i_s] = myspc.sumParticleWeight(false);
+        m_data[idx_first_species_sum_weight + i_s] = moments.weight;
 
         // Increase total number of macroparticles and total weight (all species)
         m_data[idx_total_macroparticles] += m_data[idx_first_species_macroparticles + i_s];
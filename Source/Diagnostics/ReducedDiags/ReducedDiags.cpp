@@ -99,6 +99,13 @@ void ReducedDiags::ComputeDiagsMidStep (int /*step*/)
     // (instead of at the end of the step).
 }
 
+void ReducedDiags::Flush ()
+{
+    // Defines an empty function Flush() to be overwritten if needed.
+    // Function used to write out the data that a diagnostic buffers
+    // over several steps, when the time loop returns.
+}
+
 void ReducedDiags::WriteCheckpointData (std::string const & /*dir*/)
 {
     // Defines an empty function WriteCheckpointData() to be overwritten if needed.
@@ -379,12 +379,14 @@ WarpXOpenPMDPlot::WarpXOpenPMDPlot (
     const std::string& engine_type,
     const std::map< std::string, std::string >& engine_parameters,
     const std::vector<bool>& fieldPMLdirections,
-    const std::string& authors)
+    const std::string& authors,
+    bool btd_streaming)
     : m_Series(nullptr),
       m_MPIRank{amrex::ParallelDescriptor::MyProc()},
       m_MPISize{amrex::ParallelDescriptor::NProcs()},
       m_Encoding(ie),
       m_OpenPMDFileType{openPMDFileType},
+      m_BTDStreaming{btd_streaming},
       m_fieldPMLdirections{fieldPMLdirections},
       m_authors{authors}
 {
@@ -460,16 +462,31 @@ void WarpXOpenPMDPlot::SetStep (int ts, const std::string& dirPrefix, int file_m
         }
     }
 
+    if (isBTD && m_BTDStreaming) {
+        // every buffer is a new step of the stream, the snapshot is an attribute
+        ts = m_BTDStreamStep++;
+    }
+
     m_CurrentStep = ts;
     Init(openPMD::Access::CREATE, isBTD);
 }
 
+void WarpXOpenPMDPlot::SetBTDStreamStep (int snapshotID, int bufferID, int numBuffers,
+                                         bool isLastBTDFlush)
+{
+    m_BTDSnapshotID = snapshotID;
+    m_BTDBufferID = bufferID;
+    m_BTDNumBuffers = numBuffers;
+    m_BTDLastFlush = isLastBTDFlush;
+}
+
 void WarpXOpenPMDPlot::CloseStep (bool isBTD, bool isLastBTDFlush)
 {
     // default close is true
     bool callClose = true;
     // close BTD file only when isLastBTDFlush is true
-    if (isBTD and !isLastBTDFlush) { callClose = false; }
+    // (streamed BTD buffers are steps of their own and are always closed)
+    if (isBTD and !isLastBTDFlush and !m_BTDStreaming) { callClose = false; }
     if (callClose) {
         if (m_Series) {
             GetIteration(m_CurrentStep, isBTD).close();
@@ -709,7 +726,9 @@ WarpXOpenPMDPlot::DumpToFile (ParticleContainer* pc,
     openPMD::ParticleSpecies currSpecies = currIteration.particles[name];
 
     // only BTD writes multiple times into the same step, zero for other methods
-    const unsigned long ParticleFlushOffset = isBTD ? num_already_flushed(currSpecies) : 0;
+    // (streamed BTD writes each buffer to a new step)
+    bool const appendToStep = isBTD && !m_BTDStreaming;
+    const unsigned long ParticleFlushOffset = appendToStep ? num_already_flushed(currSpecies) : 0;
 
     // prepare data structures the first time BTD has non-zero particles
     //   we set some of them to zero extent, so we need to time that well
@@ -720,7 +739,7 @@ WarpXOpenPMDPlot::DumpToFile (ParticleContainer* pc,
     // write structure & declare particles in this (lab) step empty:
     //   if not BTD, then this is the only (and last) time we flush to this step
     //   if BTD, then we may do this multiple times until it is the last BTD flush
-    bool const is_last_flush_to_step = !isBTD || (isBTD && isLastBTDFlush);
+    bool const is_last_flush_to_step = !appendToStep || (appendToStep && isLastBTDFlush);
     // well, even in BTD we have to recognize that some lab stations may have no
     //   particles - so we mark them empty at the end of station reconstruction
     bool const is_last_flush_and_never_particles =
@@ -735,7 +754,7 @@ WarpXOpenPMDPlot::DumpToFile (ParticleContainer* pc,
     // we will set up empty particles unless it's BTD, where we might add some in a following buffer dump
     //   during this setup, we mark some particle properties as constant and potentially zero-sized
     bool doParticleSetup = true;
-    if (isBTD) {
+    if (appendToStep) {
         doParticleSetup = is_first_flush_with_particles || is_last_flush_and_never_particles;
     }
 
@@ -760,7 +779,7 @@ WarpXOpenPMDPlot::DumpToFile (ParticleContainer* pc,
     for (auto currentLevel = 0; currentLevel <= pc->finestLevel(); currentLevel++) {
         auto offset = static_cast<uint64_t>( counter.m_ParticleOffsetAtRank[currentLevel] );
         // For BTD, the offset include the number of particles already flushed
-        if (isBTD) { offset += ParticleFlushOffset; }
+        if (appendToStep) { offset += ParticleFlushOffset; }
         for (ParticleIter pti(*pc, currentLevel); pti.isValid(); ++pti) {
             auto const numParticleOnTile = pti.numParticles();
             auto const numParticleOnTile64 = static_cast<uint64_t>( numParticleOnTile );
@@ -1382,7 +1401,8 @@ WarpXOpenPMDPlot::WriteOpenPMDFieldsAll ( //const std::string& filename,
 
     // is this either a regular write (true) or the first write in a
     // backtransformed diagnostic (BTD):
-    bool const first_write_to_iteration = ! m_Series->iterations.contains( iteration );
+    bool const first_write_to_iteration = (isBTD && m_BTDStreaming) ||
+        ! m_Series->iterations.contains( iteration );
 
     // meta data
     openPMD::Iteration series_iteration = GetIteration(m_CurrentStep, isBTD);
@@ -1395,6 +1415,13 @@ WarpXOpenPMDPlot::WriteOpenPMDFieldsAll ( //const std::string& filename,
         // lets see whether full_geom varies from geom[0]   xgeom[1]
         series_iteration.setTime( time );
     }
+    if (isBTD && m_BTDStreaming) {
+        // tell the consumer where this buffer belongs
+        series_iteration.setAttribute("btdSnapshot", m_BTDSnapshotID);
+        series_iteration.setAttribute("btdBuffer", m_BTDBufferID);
+        series_iteration.setAttribute("btdNumBuffers", m_BTDNumBuffers);
+        series_iteration.setAttribute("btdLastFlush", static_cast<int>(m_BTDLastFlush));
+    }
 
     // If there are no fields to be written, interrupt the function here
     if ( varnames.empty() ) { return; }
@@ -28,6 +28,8 @@
 #include <AMReX_Math.H>
 #include <AMReX_MFIter.H>
 #include <AMReX_MultiCutFab.H>
+#include <AMReX_Reduce.H>
+#include <AMReX_Tuple.H>
 
 namespace web = warpx::embedded_boundary;
 
@@ -121,6 +123,39 @@ web::MarkReducedShapeCells (
     eb_reduce_particle_shape->FillBoundary(periodicity);
 }
 
+void
+web::ClassifyBoxesByDistanceToEB (
+    amrex::LayoutData<DistanceToEB::BoxType> & box_type,
+    amrex::MultiFab const & distance_to_eb)
+{
+    BL_PROFILE("ClassifyBoxesByDistanceToEB");
+
+    for (amrex::MFIter mfi(distance_to_eb); mfi.isValid(); ++mfi) {
+
+        // Nodal valid box: a particle in this box interpolates
+        // the distance function only from these nodes
+        const amrex::Box& box = mfi.validbox();
+        amrex::Array4<amrex::Real const> const & phi = distance_to_eb.const_array(mfi);
+
+        amrex::ReduceOps<amrex::ReduceOpMin, amrex::ReduceOpMax> reduce_op;
+        amrex::ReduceData<amrex::Real, amrex::Real> reduce_data(reduce_op);
+        reduce_op.eval(box, reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> amrex::GpuTuple<amrex::Real, amrex::Real>
+            {
+                return {phi(i, j, k), phi(i, j, k)};
+            });
+        auto const phi_min_max = reduce_data.value();
+
+        if (amrex::get<0>(phi_min_max) > 0) {
+            box_type[mfi] = DistanceToEB::BoxType::regular_far;
+        } else if (amrex::get<1>(phi_min_max) < 0) {
+            box_type[mfi] = DistanceToEB::BoxType::covered;
+        } else {
+            box_type[mfi] = DistanceToEB::BoxType::cut;
+        }
+    }
+}
+
 void
 web::MarkUpdateCellsStairCase (
     std::array< std::unique_ptr<amrex::iMultiFab>,3> & eb_update,
@@ -9,6 +9,8 @@
 
 #include "EmbeddedBoundary/Enabled.H"
 #ifdef AMREX_USE_EB
+#  include "EmbeddedBoundary/DistanceToEB.H"
+#  include "EmbeddedBoundary/EmbeddedBoundaryInit.H"
 #  include "Fields.H"
 #  include "Utils/Parser/ParserUtils.H"
 #  include "Utils/TextMsg.H"
@@ -21,11 +23,14 @@
 #   include <AMReX_EB2_IF_Base.H>
 #   include <AMReX_EB_utils.H>
 #   include <AMReX_GpuQualifiers.H>
+#   include <AMReX_LayoutData.H>
+#   include <AMReX_MultiFab.H>
 #   include <AMReX_ParmParse.H>
 #   include <AMReX_REAL.H>
 #   include <AMReX_SPACE.H>
 
 #  include <cstdlib>
+#  include <memory>
 #  include <string>
 
 using namespace ablastr::fields;
@@ -122,7 +127,20 @@ WarpX::ComputeDistanceToEB ()
     for (int lev=0; lev<=maxLevel(); lev++) {
         const amrex::EB2::Level& eb_level = eb_is.getLevel(Geom(lev));
         auto const eb_fact = fieldEBFactory(lev);
-        amrex::FillSignedDistance(*m_fields.get(FieldType::distance_to_eb, lev), eb_level, eb_fact, 1);
+        amrex::MultiFab& distance_to_eb = *m_fields.get(FieldType::distance_to_eb, lev);
+        amrex::FillSignedDistance(distance_to_eb, eb_level, eb_fact, 1);
+
+        ClassifyBoxesByDistanceToEB(lev);
     }
 #endif
 }
+
+void
+WarpX::ClassifyBoxesByDistanceToEB (int lev)
+{
+    using warpx::fields::FieldType;
+    amrex::MultiFab const& distance_to_eb = *m_fields.get(FieldType::distance_to_eb, lev);
+    m_eb_box_type[lev] = std::make_unique<amrex::LayoutData<DistanceToEB::BoxType>>(
+        distance_to_eb.boxArray(), distance_to_eb.DistributionMap());
+    warpx::embedded_boundary::ClassifyBoxesByDistanceToEB(*m_eb_box_type[lev], distance_to_eb);
+}
@@ -354,6 +354,10 @@ WarpX::Evolve (int numsteps)
         const auto evolve_time_end_step = static_cast<Real>(amrex::second());
         evolve_time += evolve_time_end_step - evolve_time_beg_step;
 
+        // free the temporaries that have not been reused for a while
+        m_scratch_pool.AdvanceStep();
+        ++m_num_evolved_steps;
+
         HandleSignals();
 
         if (verbose) {
@@ -369,6 +373,10 @@ WarpX::Evolve (int numsteps)
         }
     } // End loop on time steps
 
+    // The time loop may stop before max_step (PICMI step(n), stop signal, stop_time),
+    // so the reduced diagnostics that buffer data over several steps write it out here
+    reduced_diags->Flush();
+
     // This if statement is needed for PICMI, which allows the Evolve routine to be
     // called multiple times, otherwise diagnostics will be done at every call,
     // regardless of the diagnostic period parameter provided in the inputs.
@@ -452,6 +460,9 @@ WarpX::OneStep_nosub (Real cur_time)
             }
         }
     } else {
+        // Flag the boxes in which the fields remain zero during the field solve
+        if (m_fdtd_skip_empty_boxes) { UpdateActiveFieldBoxes(); }
+
         EvolveF(0.5_rt * dt[0], DtType::FirstHalf);
         EvolveG(0.5_rt * dt[0], DtType::FirstHalf);
         FillBoundaryF(guard_cells.ng_FieldSolverF);
@@ -474,6 +485,7 @@ WarpX::OneStep_nosub (Real cur_time)
         EvolveF(0.5_rt * dt[0], DtType::SecondHalf);
         EvolveG(0.5_rt * dt[0], DtType::SecondHalf);
         EvolveB(0.5_rt * dt[0], DtType::SecondHalf, cur_time + 0.5_rt * dt[0]); // We now have B^{n+1}
+        ClearActiveFieldBoxes();
 
         if (do_pml) {
             DampPML();
@@ -596,9 +608,9 @@ void WarpX::HandleParticlesAtBoundaries (int step, amrex::Real cur_time, int num
     // interact the particles with EB walls (if present)
     if (EB::enabled()) {
         using warpx::fields::FieldType;
-        mypc->ScrapeParticlesAtEB(m_fields.get_mr_levels(FieldType::distance_to_eb, finest_level));
+        mypc->ScrapeParticlesAtEB(m_fields.get_mr_levels(FieldType::distance_to_eb, finest_level), m_eb_box_type);
         m_particle_boundary_buffer->gatherParticlesFromEmbeddedBoundaries(
-            *mypc, m_fields.get_mr_levels(FieldType::distance_to_eb, finest_level));
+            *mypc, m_fields.get_mr_levels(FieldType::distance_to_eb, finest_level), m_eb_box_type);
         mypc->deleteInvalidParticles();
     }
 
@@ -63,9 +63,9 @@ void LabFrameExplicitES::ComputeSpaceChargeField (
     setPhiBC(phi_fp, warpx.gett_new(0));
 
     // Compute the potential phi, by solving the Poisson equation
-    if (IsPythonCallbackInstalled("poissonsolver")) {
+    if (IsCallbackInstalled("poissonsolver")) {
 
-        // Use the Python level solver (user specified)
+        // Use the Python level or native plugin solver (user specified)
         ExecutePythonCallback("poissonsolver");
 
     } else {
@@ -86,7 +86,7 @@ void LabFrameExplicitES::ComputeSpaceChargeField (
     // field will be calculated in the computePhi call.
     if (!EB::enabled()) { computeE( Efield_fp, phi_fp, beta ); }
     else {
-        if (IsPythonCallbackInstalled("poissonsolver")) { computeE(Efield_fp, phi_fp, beta); }
+        if (IsCallbackInstalled("poissonsolver")) { computeE(Efield_fp, phi_fp, beta); }
     }
 }
 
@@ -8,6 +8,7 @@
 
 #include "EmbeddedBoundary/WarpXFaceInfoBox.H"
 #include "Fields.H"
+#include "HybridPICModel/HybridPICModel.H"
 #ifndef WARPX_DIM_RZ
 #   include "FiniteDifferenceAlgorithms/CartesianYeeAlgorithm.H"
 #   include "FiniteDifferenceAlgorithms/CartesianCKCAlgorithm.H"
@@ -54,7 +55,8 @@ void FiniteDifferenceSolver::EvolveB (
     PatchType patch_type,
     [[maybe_unused]] std::array< std::unique_ptr<amrex::iMultiFab>, 3 >& flag_info_cell,
     [[maybe_unused]] std::array< std::unique_ptr<amrex::LayoutData<FaceInfoBox> >, 3 >& borrowing,
-    [[maybe_unused]] amrex::Real const dt )
+    [[maybe_unused]] amrex::Real const dt,
+    [[maybe_unused]] amrex::IntVect const& ng_update )
 {
 
     using ablastr::fields::Direction;
@@ -95,18 +97,22 @@ void FiniteDifferenceSolver::EvolveB (
         Venl = fields.get_alldirs(FieldType::Venl, lev);
     }
 
+    // Boxes in which the update can be skipped, if any
+    amrex::LayoutData<int> const* active_boxes = patch_type == PatchType::fine ?
+        WarpX::getActiveFieldBoxes(lev) : nullptr;
+
     if (m_grid_type == GridType::Collocated) {
 
-        EvolveBCartesian <CartesianNodalAlgorithm> ( Bfield, Efield, Gfield, lev, dt );
+        EvolveBCartesian <CartesianNodalAlgorithm> ( Bfield, Efield, Gfield, lev, dt, ng_update, active_boxes );
 
     } else if ((m_fdtd_algo == ElectromagneticSolverAlgo::Yee) ||
                (m_fdtd_algo == ElectromagneticSolverAlgo::HybridPIC)) {
 
-        EvolveBCartesian <CartesianYeeAlgorithm> ( Bfield, Efield, Gfield, lev, dt );
+        EvolveBCartesian <CartesianYeeAlgorithm> ( Bfield, Efield, Gfield, lev, dt, ng_update, active_boxes );
 
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::CKC) {
 
-        EvolveBCartesian <CartesianCKCAlgorithm> ( Bfield, Efield, Gfield, lev, dt );
+        EvolveBCartesian <CartesianCKCAlgorithm> ( Bfield, Efield, Gfield, lev, dt, ng_update, active_boxes );
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::ECT) {
         EvolveBCartesianECT(Bfield, face_areas, area_mod, ECTRhofield, Venl, flag_info_cell,
                             borrowing, lev, dt);
@@ -124,15 +130,22 @@ void FiniteDifferenceSolver::EvolveBCartesian (
     ablastr::fields::VectorField const& Bfield,
     ablastr::fields::VectorField const& Efield,
     amrex::MultiFab const * Gfield,
-    int lev, amrex::Real const dt ) {
+    int lev, amrex::Real const dt,
+    amrex::IntVect const& ng_update,
+    amrex::LayoutData<int> const* active_boxes ) {
 
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
 
+    amrex::Geometry const& geom = WarpX::GetInstance().Geom(lev);
+
     // Loop through the grids, and over the tiles within each grid
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Bfield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+        // Skip the boxes in which the fields remain zero
+        if (active_boxes && (*active_boxes)[mfi] == 0) { continue; }
+
         if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
         {
             amrex::Gpu::synchronize();
@@ -155,10 +168,10 @@ void FiniteDifferenceSolver::EvolveBCartesian (
         Real const * const AMREX_RESTRICT coefs_z = m_stencil_coefs_z.dataPtr();
         auto const n_coefs_z = static_cast<int>(m_stencil_coefs_z.size());
 
-        // Extract tileboxes for which to loop
-        Box const& tbx  = mfi.tilebox(Bfield[0]->ixType().toIntVect());
-        Box const& tby  = mfi.tilebox(Bfield[1]->ixType().toIntVect());
-        Box const& tbz  = mfi.tilebox(Bfield[2]->ixType().toIntVect());
+        // Extract tileboxes for which to loop, including ng_update guard cells
+        Box const tbx = HybridPICModel::GetUpdateTileBox(mfi, Bfield[0]->ixType().toIntVect(), ng_update, geom);
+        Box const tby = HybridPICModel::GetUpdateTileBox(mfi, Bfield[1]->ixType().toIntVect(), ng_update, geom);
+        Box const tbz = HybridPICModel::GetUpdateTileBox(mfi, Bfield[2]->ixType().toIntVect(), ng_update, geom);
 
         // Loop over the cells and update the fields
         amrex::ParallelFor(tbx, tby, tbz,
@@ -73,6 +73,12 @@ void FiniteDifferenceSolver::EvolveE (
                  fields.get(FieldType::F_fp, lev) : fields.get(FieldType::F_cp, lev);
     }
 
+#ifndef WARPX_DIM_RZ
+    // Boxes in which the update can be skipped, if any
+    amrex::LayoutData<int> const* active_boxes = patch_type == PatchType::fine ?
+        WarpX::getActiveFieldBoxes(lev) : nullptr;
+#endif
+
     // Select algorithm (The choice of algorithm is a runtime option,
     // but we compile code for each algorithm, using templates)
 #ifdef WARPX_DIM_RZ
@@ -81,15 +87,15 @@ void FiniteDifferenceSolver::EvolveE (
 #else
     if (m_grid_type == GridType::Collocated) {
 
-        EvolveECartesian <CartesianNodalAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt );
+        EvolveECartesian <CartesianNodalAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt, active_boxes );
 
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::Yee || m_fdtd_algo == ElectromagneticSolverAlgo::ECT) {
 
-        EvolveECartesian <CartesianYeeAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt );
+        EvolveECartesian <CartesianYeeAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt, active_boxes );
 
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::CKC) {
 
-        EvolveECartesian <CartesianCKCAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt );
+        EvolveECartesian <CartesianCKCAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt, active_boxes );
 
 #endif
     } else {
@@ -108,7 +114,8 @@ void FiniteDifferenceSolver::EvolveECartesian (
     ablastr::fields::VectorField const& Jfield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3> const& eb_update_E,
     amrex::MultiFab const* Ffield,
-    int lev, amrex::Real const dt ) {
+    int lev, amrex::Real const dt,
+    amrex::LayoutData<int> const* active_boxes ) {
 
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
     Real constexpr c2 = PhysConst::c * PhysConst::c;
@@ -118,6 +125,9 @@ void FiniteDifferenceSolver::EvolveECartesian (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Efield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+        // Skip the boxes in which the fields remain zero
+        if (active_boxes && (*active_boxes)[mfi] == 0) { continue; }
+
         if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
         {
             amrex::Gpu::synchronize();
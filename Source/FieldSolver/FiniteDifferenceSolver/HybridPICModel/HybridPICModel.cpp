@@ -15,8 +15,14 @@
 #include "Fields.H"
 #include "Particles/MultiParticleContainer.H"
 #include "ExternalVectorPotential.H"
+#include "Utils/TextMsg.H"
 #include "WarpX.H"
 
+#include <ablastr/utils/Communication.H>
+
+#include <algorithm>
+#include <string>
+
 using namespace amrex;
 using warpx::fields::FieldType;
 
@@ -35,6 +41,15 @@ void HybridPICModel::ReadParameters ()
 
     utils::parser::queryWithParser(pp_hybrid, "holmstrom_vacuum_region", m_holmstrom_vacuum_region);
 
+    // With deep halos, several field pushes are done between two exchanges
+    // of the guard cells, with redundant calculations in the guard cells.
+    pp_hybrid.query("use_deep_halo", m_use_deep_halo);
+#ifdef WARPX_DIM_RZ
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        !m_use_deep_halo,
+        "hybrid_pic_model.use_deep_halo is not implemented in RZ geometry.");
+#endif
+
     // The hybrid model requires an electron temperature, reference density
     // and exponent to be given. These values will be used to calculate the
     // electron pressure according to p = n0 * Te * (n/n0)^gamma
@@ -125,15 +140,17 @@ void HybridPICModel::AllocateLevelMFs (
 
     // the external current density multifab matches the current staggering and
     // one ghost cell is used since we interpolate the current to a nodal grid
+    // (with deep halos, the plasma current is calculated in all the ghost cells)
+    const IntVect ngJ_external = m_use_deep_halo ? ngJ : IntVect(1);
     fields.alloc_init(FieldType::hybrid_current_fp_external, Direction{0},
         lev, amrex::convert(ba, jx_nodal_flag),
-        dm, ncomps, IntVect(1), 0.0_rt);
+        dm, ncomps, ngJ_external, 0.0_rt);
     fields.alloc_init(FieldType::hybrid_current_fp_external, Direction{1},
         lev, amrex::convert(ba, jy_nodal_flag),
-        dm, ncomps, IntVect(1), 0.0_rt);
+        dm, ncomps, ngJ_external, 0.0_rt);
     fields.alloc_init(FieldType::hybrid_current_fp_external, Direction{2},
         lev, amrex::convert(ba, jz_nodal_flag),
-        dm, ncomps, IntVect(1), 0.0_rt);
+        dm, ncomps, ngJ_external, 0.0_rt);
 
     if (m_add_external_fields) {
         m_external_vector_potential->AllocateLevelMFs(
@@ -186,6 +203,10 @@ void HybridPICModel::InitData (const ablastr::fields::MultiFabRegister& fields)
     auto& warpx = WarpX::GetInstance();
     using ablastr::fields::Direction;
 
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        !(m_use_deep_halo && EB::enabled()),
+        "hybrid_pic_model.use_deep_halo is not implemented with embedded boundaries.");
+
     // Get the grid staggering of the fields involved in calculating E
     amrex::IntVect Jx_stag = fields.get(FieldType::current_fp, Direction{0}, 0)->ixType().toIntVect();
     amrex::IntVect Jy_stag = fields.get(FieldType::current_fp, Direction{1}, 0)->ixType().toIntVect();
@@ -267,6 +288,7 @@ void HybridPICModel::InitData (const ablastr::fields::MultiFabRegister& fields)
             m_J_external[2],
             lev, PatchType::fine,
             warpx.GetEBUpdateEFlag());
+        FillBoundaryCurrentExternal(lev);
     }
 
     if (m_add_external_fields) {
@@ -274,6 +296,73 @@ void HybridPICModel::InitData (const ablastr::fields::MultiFabRegister& fields)
     }
 }
 
+amrex::IntVect HybridPICModel::InitDeepHalo (amrex::IntVect const& max_grid_size)
+{
+    if (!m_use_deep_halo) { return amrex::IntVect::TheZeroVector(); }
+
+    // The guard cells of J and E are never exchanged during the substeps, and
+    // the guard cells of B are only exchanged at the end of an RK substep,
+    // since the intermediate RK stages are combined with B at the beginning of
+    // the substep. The number of substeps between two exchanges grows with the
+    // total number of substeps, and is limited so that the width of the halo
+    // is at most 1/4 of the size of the boxes, to bound the redundant work in
+    // the guard cells. Each RK substep does 4 field pushes.
+    const int ng_per_substep = 4*deep_halo_stencil_width;
+    const int max_substeps_grid = std::max(1, max_grid_size.min()/(4*ng_per_substep));
+    m_substeps_per_exchange = std::clamp(m_substeps/10, 1, max_substeps_grid);
+    m_pushes_since_exchange = 0;
+
+    const amrex::IntVect ng_deep_halo(ng_per_substep*m_substeps_per_exchange);
+    if (ng_deep_halo != m_ng_deep_halo) {
+        amrex::Print() << Utils::TextMsg::Info(
+            "Hybrid-PIC deep halos: exchanging the guard cells of B every "
+            + std::to_string(m_substeps_per_exchange) + " substep(s), with "
+            + std::to_string(ng_deep_halo.max()) + " guard cells");
+    }
+    m_ng_deep_halo = ng_deep_halo;
+
+    return m_ng_deep_halo;
+}
+
+void HybridPICModel::FillBoundaryDeepHalo (std::optional<bool> nodal_sync, bool force)
+{
+    if (!m_use_deep_halo) { return; }
+
+    if (m_pushes_since_exchange > 0 || force) {
+        auto& warpx = WarpX::GetInstance();
+        warpx.FillBoundaryB(m_ng_deep_halo, nodal_sync);
+    }
+    m_pushes_since_exchange = 0;
+}
+
+amrex::Box HybridPICModel::GetUpdateTileBox (
+    amrex::MFIter const& mfi,
+    amrex::IntVect const& ixtype,
+    amrex::IntVect const& ng_update,
+    amrex::Geometry const& geom)
+{
+    if (ng_update == amrex::IntVect::TheZeroVector()) { return mfi.tilebox(ixtype); }
+
+    // The tiles are only extended at the boundaries of the box, so that
+    // the tiles of a box do not overlap
+    amrex::Box const tb = mfi.tilebox(ixtype, ng_update);
+    amrex::Box domain = amrex::convert(geom.Domain(), ixtype);
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        if (geom.isPeriodic(idim)) { domain.grow(idim, ng_update[idim]); }
+    }
+    return tb & domain;
+}
+
+void HybridPICModel::FillBoundaryCurrentExternal (int lev) const
+{
+    // With deep halos, the external current is needed in all the guard cells
+    if (!m_use_deep_halo) { return; }
+
+    auto& warpx = WarpX::GetInstance();
+    ablastr::fields::VectorField current_fp_external = warpx.m_fields.get_alldirs(FieldType::hybrid_current_fp_external, lev);
+    for (int i=0; i<3; i++) { current_fp_external[i]->FillBoundary(warpx.Geom(lev).periodicity()); }
+}
+
 void HybridPICModel::GetCurrentExternal ()
 {
     if (!m_external_current_has_time_dependence) { return; }
@@ -288,45 +377,68 @@ void HybridPICModel::GetCurrentExternal ()
             m_J_external[2],
             lev, PatchType::fine,
             warpx.GetEBUpdateEFlag());
+        FillBoundaryCurrentExternal(lev);
     }
 }
 
 void HybridPICModel::CalculatePlasmaCurrent (
     ablastr::fields::MultiLevelVectorField const& Bfield,
-    amrex::Vector<std::array< std::unique_ptr<amrex::iMultiFab>,3 > >& eb_update_E)
+    amrex::Vector<std::array< std::unique_ptr<amrex::iMultiFab>,3 > >& eb_update_E,
+    amrex::IntVect const& ng_update)
 {
     auto& warpx = WarpX::GetInstance();
     for (int lev = 0; lev <= warpx.finestLevel(); ++lev)
     {
-        CalculatePlasmaCurrent(Bfield[lev], eb_update_E[lev], lev);
+        // On the finer levels, the guard cells of B outside of the fine patch
+        // are interpolated from the level below, which has already been updated
+        if (lev > 0) {
+            for (int i=0; i<3; i++) {
+                warpx.InterpolateFromCoarseLevel(*Bfield[lev][i], *Bfield[lev-1][i], lev);
+            }
+        }
+        CalculatePlasmaCurrent(Bfield[lev], eb_update_E[lev], lev, ng_update);
     }
 }
 
 void HybridPICModel::CalculatePlasmaCurrent (
     ablastr::fields::VectorField const& Bfield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3 >& eb_update_E,
-    const int lev)
+    const int lev,
+    amrex::IntVect const& ng_update)
 {
     WARPX_PROFILE("HybridPICModel::CalculatePlasmaCurrent()");
 
     auto& warpx = WarpX::GetInstance();
     ablastr::fields::VectorField current_fp_plasma = warpx.m_fields.get_alldirs(FieldType::hybrid_current_fp_plasma, lev);
     warpx.get_pointer_fdtd_solver_fp(lev)->CalculateCurrentAmpere(
-        current_fp_plasma, Bfield, eb_update_E, lev
+        current_fp_plasma, Bfield, eb_update_E, lev, ng_update
     );
 
     // we shouldn't apply the boundary condition to J since J = J_i - J_e but
     // the boundary correction was already applied to J_i and the B-field
     // boundary ensures that J itself complies with the boundary conditions, right?
     // ApplyJfieldBoundary(lev, Jfield[0].get(), Jfield[1].get(), Jfield[2].get());
-    for (int i=0; i<3; i++) { current_fp_plasma[i]->FillBoundary(warpx.Geom(lev).periodicity()); }
+    // When J is calculated in the guard cells, no communication is needed.
+    if (ng_update == IntVect::TheZeroVector()) {
+        for (int i=0; i<3; i++) { current_fp_plasma[i]->FillBoundary(warpx.Geom(lev).periodicity()); }
+    }
 
     // Subtract external current from "Ampere" current calculated above. Note
     // we need to include 1 ghost cell since later we will interpolate the
     // plasma current to a nodal grid.
     ablastr::fields::VectorField current_fp_external = warpx.m_fields.get_alldirs(FieldType::hybrid_current_fp_external, lev);
+    const IntVect ng_minus = amrex::max(ng_update, IntVect(1));
     for (int i=0; i<3; i++) {
-        current_fp_plasma[i]->minus(*current_fp_external[i], 0, 1, 1);
+        current_fp_plasma[i]->minus(*current_fp_external[i], 0, 1, ng_minus);
+    }
+
+    // On the finer levels, the guard cells outside of the fine patch are
+    // interpolated from the plasma current of the level below
+    if (lev > 0) {
+        ablastr::fields::VectorField current_fp_plasma_crse = warpx.m_fields.get_alldirs(FieldType::hybrid_current_fp_plasma, lev-1);
+        for (int i=0; i<3; i++) {
+            warpx.InterpolateFromCoarseLevel(*current_fp_plasma[i], *current_fp_plasma_crse[i], lev);
+        }
     }
 
 }
@@ -337,14 +449,15 @@ void HybridPICModel::HybridPICSolveE (
     ablastr::fields::MultiLevelVectorField const& Bfield,
     ablastr::fields::MultiLevelScalarField const& rhofield,
     amrex::Vector<std::array< std::unique_ptr<amrex::iMultiFab>,3 > >& eb_update_E,
-    const bool solve_for_Faraday) const
+    const bool solve_for_Faraday,
+    amrex::IntVect const& ng_update) const
 {
     auto& warpx = WarpX::GetInstance();
     for (int lev = 0; lev <= warpx.finestLevel(); ++lev)
     {
         HybridPICSolveE(
             Efield[lev], Jfield[lev], Bfield[lev], *rhofield[lev],
-            eb_update_E[lev], lev, solve_for_Faraday
+            eb_update_E[lev], lev, solve_for_Faraday, ng_update
         );
     }
     // Allow execution of Python callback after E-field push
@@ -357,19 +470,15 @@ void HybridPICModel::HybridPICSolveE (
     ablastr::fields::VectorField const& Bfield,
     amrex::MultiFab const& rhofield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3 >& eb_update_E,
-    const int lev, const bool solve_for_Faraday) const
+    const int lev, const bool solve_for_Faraday,
+    amrex::IntVect const& ng_update) const
 {
     WARPX_PROFILE("WarpX::HybridPICSolveE()");
 
     HybridPICSolveE(
         Efield, Jfield, Bfield, rhofield, eb_update_E, lev,
-        PatchType::fine, solve_for_Faraday
+        PatchType::fine, solve_for_Faraday, ng_update
     );
-    if (lev > 0)
-    {
-        amrex::Abort(Utils::TextMsg::Err(
-        "HybridPICSolveE: Only one level implemented for hybrid-PIC solver."));
-    }
 }
 
 void HybridPICModel::HybridPICSolveE (
@@ -379,7 +488,8 @@ void HybridPICModel::HybridPICSolveE (
     amrex::MultiFab const& rhofield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3 >& eb_update_E,
     const int lev, PatchType patch_type,
-    const bool solve_for_Faraday) const
+    const bool solve_for_Faraday,
+    amrex::IntVect const& ng_update) const
 {
     auto& warpx = WarpX::GetInstance();
 
@@ -389,7 +499,8 @@ void HybridPICModel::HybridPICSolveE (
     // Solve E field in regular cells
     warpx.get_pointer_fdtd_solver_fp(lev)->HybridPICSolveE(
         Efield, current_fp_plasma, Jfield, Bfield, rhofield,
-        *electron_pressure_fp, eb_update_E, lev, this, solve_for_Faraday
+        *electron_pressure_fp, eb_update_E, lev, this, solve_for_Faraday,
+        ng_update
     );
     amrex::Real const time = warpx.gett_old(0) + warpx.getdt(0);
     warpx.ApplyEfieldBoundary(lev, patch_type, time);
@@ -417,6 +528,14 @@ void HybridPICModel::CalculateElectronPressure(const int lev) const
         *electron_pressure_fp,
         *rho_fp
     );
+    // On the finer levels, the guard cells outside of the fine patch are
+    // interpolated from the electron pressure of the level below
+    if (lev > 0) {
+        warpx.InterpolateFromCoarseLevel(
+            *electron_pressure_fp,
+            *warpx.m_fields.get(FieldType::hybrid_electron_pressure_fp, lev-1),
+            lev);
+    }
     warpx.ApplyElectronPressureBoundary(lev, PatchType::fine);
     electron_pressure_fp->FillBoundary(warpx.Geom(lev).periodicity());
 }
@@ -461,42 +580,35 @@ void HybridPICModel::BfieldEvolveRK (
     IntVect ng, std::optional<bool> nodal_sync )
 {
     auto& warpx = WarpX::GetInstance();
-    for (int lev = 0; lev <= warpx.finestLevel(); ++lev)
-    {
-        BfieldEvolveRK(
-            Bfield, Efield, Jfield, rhofield, eb_update_E, dt, lev, dt_type,
-            ng, nodal_sync
-        );
-    }
-}
+    const int finest_level = warpx.finestLevel();
+
+    // With deep halos, the linear combinations below also include the guard
+    // cells of B that are updated by the field pushes
+    const IntVect ng_rk = m_use_deep_halo ? m_ng_deep_halo : ng;
 
-void HybridPICModel::BfieldEvolveRK (
-    ablastr::fields::MultiLevelVectorField const& Bfield,
-    ablastr::fields::MultiLevelVectorField const& Efield,
-    ablastr::fields::MultiLevelVectorField const& Jfield,
-    ablastr::fields::MultiLevelScalarField const& rhofield,
-    amrex::Vector<std::array< std::unique_ptr<amrex::iMultiFab>,3 > >& eb_update_E,
-    amrex::Real dt, int lev, DtType dt_type,
-    IntVect ng, std::optional<bool> nodal_sync )
-{
     // Make copies of the B-field multifabs at t = n and create multifabs for
     // each direction to store the Runge-Kutta intermediate terms. Each
     // multifab has 2 components for the different terms that need to be stored.
-    std::array< MultiFab, 3 > B_old;
-    std::array< MultiFab, 3 > K;
-    for (int ii = 0; ii < 3; ii++)
+    // All the levels are advanced together, so that the guard cells of the
+    // finer levels are interpolated from the coarser levels at the same stage.
+    amrex::Vector<std::array< MultiFab, 3 >> B_old(finest_level+1);
+    amrex::Vector<std::array< MultiFab, 3 >> K(finest_level+1);
+    for (int lev = 0; lev <= finest_level; ++lev)
     {
-        B_old[ii] = MultiFab(
-            Bfield[lev][ii]->boxArray(), Bfield[lev][ii]->DistributionMap(), 1,
-            Bfield[lev][ii]->nGrowVect()
-        );
-        MultiFab::Copy(B_old[ii], *Bfield[lev][ii], 0, 0, 1, ng);
+        for (int ii = 0; ii < 3; ii++)
+        {
+            B_old[lev][ii] = MultiFab(
+                Bfield[lev][ii]->boxArray(), Bfield[lev][ii]->DistributionMap(), 1,
+                Bfield[lev][ii]->nGrowVect()
+            );
+            MultiFab::Copy(B_old[lev][ii], *Bfield[lev][ii], 0, 0, 1, ng_rk);
 
-        K[ii] = MultiFab(
-            Bfield[lev][ii]->boxArray(), Bfield[lev][ii]->DistributionMap(), 2,
-            Bfield[lev][ii]->nGrowVect()
-        );
-        K[ii].setVal(0.0);
+            K[lev][ii] = MultiFab(
+                Bfield[lev][ii]->boxArray(), Bfield[lev][ii]->DistributionMap(), 2,
+                Bfield[lev][ii]->nGrowVect()
+            );
+            K[lev][ii].setVal(0.0);
+        }
     }
 
     // The Runge-Kutta scheme begins here.
@@ -508,12 +620,15 @@ void HybridPICModel::BfieldEvolveRK (
 
     // The Bfield is now given by:
     // B_new = B_old + 0.5 * dt * [-curl x E(B_old)] = B_old + 0.5 * dt * K0.
-    for (int ii = 0; ii < 3; ii++)
+    for (int lev = 0; lev <= finest_level; ++lev)
     {
-        // Extract 0.5 * dt * K0 for each direction into index 0 of K.
-        MultiFab::LinComb(
-            K[ii], 1._rt, *Bfield[lev][ii], 0, -1._rt, B_old[ii], 0, 0, 1, ng
-        );
+        for (int ii = 0; ii < 3; ii++)
+        {
+            // Extract 0.5 * dt * K0 for each direction into index 0 of K.
+            MultiFab::LinComb(
+                K[lev][ii], 1._rt, *Bfield[lev][ii], 0, -1._rt, B_old[lev][ii], 0, 0, 1, ng_rk
+            );
+        }
     }
 
     // Step 2:
@@ -525,15 +640,18 @@ void HybridPICModel::BfieldEvolveRK (
     // The Bfield is now given by:
     // B_new = B_old + 0.5 * dt * K0 + 0.5 * dt * [-curl x E(B_old + 0.5 * dt * K1)]
     //       = B_old + 0.5 * dt * K0 + 0.5 * dt * K1
-    for (int ii = 0; ii < 3; ii++)
+    for (int lev = 0; lev <= finest_level; ++lev)
     {
-        // Subtract 0.5 * dt * K0 from the Bfield for each direction, to get
-        // B_new = B_old + 0.5 * dt * K1.
-        MultiFab::Subtract(*Bfield[lev][ii], K[ii], 0, 0, 1, ng);
-        // Extract 0.5 * dt * K1 for each direction into index 1 of K.
-        MultiFab::LinComb(
-            K[ii], 1._rt, *Bfield[lev][ii], 0, -1._rt, B_old[ii], 0, 1, 1, ng
-        );
+        for (int ii = 0; ii < 3; ii++)
+        {
+            // Subtract 0.5 * dt * K0 from the Bfield for each direction, to get
+            // B_new = B_old + 0.5 * dt * K1.
+            MultiFab::Subtract(*Bfield[lev][ii], K[lev][ii], 0, 0, 1, ng_rk);
+            // Extract 0.5 * dt * K1 for each direction into index 1 of K.
+            MultiFab::LinComb(
+                K[lev][ii], 1._rt, *Bfield[lev][ii], 0, -1._rt, B_old[lev][ii], 0, 1, 1, ng_rk
+            );
+        }
     }
 
     // Step 3:
@@ -545,11 +663,14 @@ void HybridPICModel::BfieldEvolveRK (
     // The Bfield is now given by:
     // B_new = B_old + 0.5 * dt * K1 + dt * [-curl  x E(B_old + 0.5 * dt * K1)]
     //       = B_old + 0.5 * dt * K1 + dt * K2
-    for (int ii = 0; ii < 3; ii++)
+    for (int lev = 0; lev <= finest_level; ++lev)
     {
-        // Subtract 0.5 * dt * K1 from the Bfield for each direction to get
-        // B_new = B_old + dt * K2.
-        MultiFab::Subtract(*Bfield[lev][ii], K[ii], 1, 0, 1, ng);
+        for (int ii = 0; ii < 3; ii++)
+        {
+            // Subtract 0.5 * dt * K1 from the Bfield for each direction to get
+            // B_new = B_old + dt * K2.
+            MultiFab::Subtract(*Bfield[lev][ii], K[lev][ii], 1, 0, 1, ng_rk);
+        }
     }
 
     // Step 4:
@@ -561,28 +682,69 @@ void HybridPICModel::BfieldEvolveRK (
     // The Bfield is now given by:
     // B_new = B_old + dt * K2 + 0.5 * dt * [-curl x E(B_old + dt * K2)]
     //       = B_old + dt * K2 + 0.5 * dt * K3
-    for (int ii = 0; ii < 3; ii++)
+    for (int lev = 0; lev <= finest_level; ++lev)
     {
-        // Subtract B_old from the Bfield for each direction, to get
-        // B = dt * K2 + 0.5 * dt * K3.
-        MultiFab::Subtract(*Bfield[lev][ii], B_old[ii], 0, 0, 1, ng);
+        for (int ii = 0; ii < 3; ii++)
+        {
+            // Subtract B_old from the Bfield for each direction, to get
+            // B = dt * K2 + 0.5 * dt * K3.
+            MultiFab::Subtract(*Bfield[lev][ii], B_old[lev][ii], 0, 0, 1, ng_rk);
+
+            // Add dt * K2 + 0.5 * dt * K3 to index 0 of K (= 0.5 * dt * K0).
+            MultiFab::Add(K[lev][ii], *Bfield[lev][ii], 0, 0, 1, ng_rk);
+
+            // Add 2 * 0.5 * dt * K1 to index 0 of K.
+            MultiFab::LinComb(
+                K[lev][ii], 1.0, K[lev][ii], 0, 2.0, K[lev][ii], 1, 0, 1, ng_rk
+            );
 
-        // Add dt * K2 + 0.5 * dt * K3 to index 0 of K (= 0.5 * dt * K0).
-        MultiFab::Add(K[ii], *Bfield[lev][ii], 0, 0, 1, ng);
+            // Overwrite the Bfield with the Runge-Kutta sum:
+            // B_new = B_old + 1/3 * dt * (0.5 * K0 + K1 + K2 + 0.5 * K3).
+            MultiFab::LinComb(
+                *Bfield[lev][ii], 1.0, B_old[lev][ii], 0, 1.0/3.0, K[lev][ii], 0, 0, 1, ng_rk
+            );
+        }
+    }
 
-        // Add 2 * 0.5 * dt * K1 to index 0 of K.
-        MultiFab::LinComb(
-            K[ii], 1.0, K[ii], 0, 2.0, K[ii], 1, 0, 1, ng
-        );
+    // With mesh refinement, the coarser levels take the values of the finer
+    // levels where they overlap, so that they stay consistent
+    SyncFieldAcrossLevels(Bfield, ng, nodal_sync);
 
-        // Overwrite the Bfield with the Runge-Kutta sum:
-        // B_new = B_old + 1/3 * dt * (0.5 * K0 + K1 + K2 + 0.5 * K3).
-        MultiFab::LinComb(
-            *Bfield[lev][ii], 1.0, B_old[ii], 0, 1.0/3.0, K[ii], 0, 0, 1, ng
-        );
+    // With deep halos, exchange the guard cells of B once their valid part is exhausted
+    if (m_use_deep_halo && m_pushes_since_exchange == 4*m_substeps_per_exchange) {
+        FillBoundaryDeepHalo(nodal_sync);
     }
 }
 
+void HybridPICModel::SyncFieldAcrossLevels (
+    ablastr::fields::MultiLevelVectorField const& field,
+    IntVect ng, std::optional<bool> nodal_sync) const
+{
+    auto& warpx = WarpX::GetInstance();
+    const int finest_level = warpx.finestLevel();
+    if (finest_level == 0) { return; }
+
+    WARPX_PROFILE("HybridPICModel::SyncFieldAcrossLevels()");
+
+    for (int lev = finest_level; lev > 0; --lev) {
+        for (int ii = 0; ii < 3; ii++) {
+            warpx.AverageDownFromFineLevel(*field[lev-1][ii], *field[lev][ii], lev);
+        }
+    }
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        for (int ii = 0; ii < 3; ii++) {
+            // Only the coarser levels were modified, and need to be communicated
+            if (lev < finest_level) {
+                ablastr::utils::communication::FillBoundary(
+                    *field[lev][ii], ng, WarpX::do_single_precision_comms,
+                    warpx.Geom(lev).periodicity(), nodal_sync);
+            }
+            if (lev > 0) {
+                warpx.InterpolateFromCoarseLevel(*field[lev][ii], *field[lev-1][ii], lev);
+            }
+        }
+    }
+}
 
 void HybridPICModel::FieldPush (
     ablastr::fields::MultiLevelVectorField const& Bfield,
@@ -597,6 +759,21 @@ void HybridPICModel::FieldPush (
 
     amrex::Real const t_old = warpx.gett_old(0);
 
+    if (m_use_deep_halo) {
+        // The guard cells of B are valid up to ng_B cells since the last
+        // exchange. J, E and B are calculated in as many guard cells as this
+        // allows, so that no communication is needed until ng_B is exhausted.
+        const IntVect ng_B = m_ng_deep_halo - IntVect(deep_halo_stencil_width*m_pushes_since_exchange);
+        const IntVect ng_E = ng_B - IntVect(deep_halo_stencil_width);
+
+        CalculatePlasmaCurrent(Bfield, eb_update_E, ng_B - IntVect(1));
+        HybridPICSolveE(Efield, Jfield, Bfield, rhofield, eb_update_E, true, ng_E);
+        warpx.EvolveB(dt, dt_type, t_old, ng_E);
+
+        ++m_pushes_since_exchange;
+        return;
+    }
+
     // Calculate J = curl x B / mu0 - J_ext
     CalculatePlasmaCurrent(Bfield, eb_update_E);
     // Calculate the E-field from Ohm's law
@@ -17,6 +17,7 @@
 #   include "FiniteDifferenceAlgorithms/CartesianYeeAlgorithm.H"
 #endif
 #include "HybridPICModel/HybridPICModel.H"
+#include "Utils/ScratchMultiFabPool.H"
 #include "Utils/TextMsg.H"
 #include "WarpX.H"
 
@@ -29,7 +30,8 @@ void FiniteDifferenceSolver::CalculateCurrentAmpere (
     ablastr::fields::VectorField & Jfield,
     ablastr::fields::VectorField const& Bfield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3 > const& eb_update_E,
-    int lev )
+    int lev,
+    [[maybe_unused]] amrex::IntVect const& ng_update )
 {
     // Select algorithm (The choice of algorithm is a runtime option,
     // but we compile code for each algorithm, using templates)
@@ -41,7 +43,7 @@ void FiniteDifferenceSolver::CalculateCurrentAmpere (
 
 #else
         CalculateCurrentAmpereCartesian <CartesianYeeAlgorithm> (
-            Jfield, Bfield, eb_update_E, lev
+            Jfield, Bfield, eb_update_E, lev, ng_update
         );
 
 #endif
@@ -256,12 +258,15 @@ void FiniteDifferenceSolver::CalculateCurrentAmpereCartesian (
     ablastr::fields::VectorField& Jfield,
     ablastr::fields::VectorField const& Bfield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3 > const& eb_update_E,
-    int lev
+    int lev,
+    amrex::IntVect const& ng_update
 )
 {
     // for the profiler
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
 
+    amrex::Geometry const& geom = WarpX::GetInstance().Geom(lev);
+
     // reset Jfield
     Jfield[0]->setVal(0);
     Jfield[1]->setVal(0);
@@ -305,10 +310,10 @@ void FiniteDifferenceSolver::CalculateCurrentAmpereCartesian (
         Real const * const AMREX_RESTRICT coefs_z = m_stencil_coefs_z.dataPtr();
         auto const n_coefs_z = static_cast<int>(m_stencil_coefs_z.size());
 
-        // Extract tileboxes for which to loop
-        Box const& tjx  = mfi.tilebox(Jfield[0]->ixType().toIntVect());
-        Box const& tjy  = mfi.tilebox(Jfield[1]->ixType().toIntVect());
-        Box const& tjz  = mfi.tilebox(Jfield[2]->ixType().toIntVect());
+        // Extract tileboxes for which to loop, including ng_update guard cells
+        Box const tjx = HybridPICModel::GetUpdateTileBox(mfi, Jfield[0]->ixType().toIntVect(), ng_update, geom);
+        Box const tjy = HybridPICModel::GetUpdateTileBox(mfi, Jfield[1]->ixType().toIntVect(), ng_update, geom);
+        Box const tjz = HybridPICModel::GetUpdateTileBox(mfi, Jfield[2]->ixType().toIntVect(), ng_update, geom);
 
         Real const one_over_mu0 = 1._rt / PhysConst::mu0;
 
@@ -373,7 +378,8 @@ void FiniteDifferenceSolver::HybridPICSolveE (
     amrex::MultiFab const& Pefield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3 > const& eb_update_E,
     int lev, HybridPICModel const* hybrid_model,
-    const bool solve_for_Faraday)
+    const bool solve_for_Faraday,
+    [[maybe_unused]] amrex::IntVect const& ng_update)
 {
     // Select algorithm (The choice of algorithm is a runtime option,
     // but we compile code for each algorithm, using templates)
@@ -389,7 +395,7 @@ void FiniteDifferenceSolver::HybridPICSolveE (
 
         HybridPICSolveECartesian <CartesianYeeAlgorithm> (
             Efield, Jfield, Jifield, Bfield, rhofield, Pefield,
-            eb_update_E, lev, hybrid_model, solve_for_Faraday
+            eb_update_E, lev, hybrid_model, solve_for_Faraday, ng_update
         );
 
 #endif
@@ -473,7 +479,9 @@ void FiniteDifferenceSolver::HybridPICSolveECylindrical (
     // these values will be interpolated to the Yee mesh which is contained
     // by the nodal mesh.
     auto const& ba = convert(rhofield.boxArray(), IntVect::TheNodeVector());
-    MultiFab enE_nodal_mf(ba, rhofield.DistributionMap(), 3, IntVect::TheZeroVector());
+    ScratchMultiFab enE_nodal_scratch = WarpX::GetInstance().GetScratchPool().Get(
+        ba, rhofield.DistributionMap(), 3, IntVect::TheZeroVector(), "enE_nodal");
+    MultiFab& enE_nodal_mf = *enE_nodal_scratch;
 
     // Loop through the grids, and over the tiles within each grid for the
     // initial, nodal calculation of E
@@ -835,11 +843,14 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
     amrex::MultiFab const& Pefield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3 > const& eb_update_E,
     int lev, HybridPICModel const* hybrid_model,
-    const bool solve_for_Faraday )
+    const bool solve_for_Faraday,
+    amrex::IntVect const& ng_update )
 {
     // for the profiler
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
 
+    amrex::Geometry const& geom = WarpX::GetInstance().Geom(lev);
+
     using namespace ablastr::coarsen::sample;
 
     // get hybrid model parameters
@@ -890,9 +901,11 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
     // since all three components will be calculated on the same grid.
     // Also note that enE_nodal_mf does not need to have any guard cells since
     // these values will be interpolated to the Yee mesh which is contained
-    // by the nodal mesh.
+    // by the nodal mesh, unless E is also calculated in ng_update guard cells.
     auto const& ba = convert(rhofield.boxArray(), IntVect::TheNodeVector());
-    MultiFab enE_nodal_mf(ba, rhofield.DistributionMap(), 3, IntVect::TheZeroVector());
+    ScratchMultiFab enE_nodal_scratch = WarpX::GetInstance().GetScratchPool().Get(
+        ba, rhofield.DistributionMap(), 3, ng_update, "enE_nodal");
+    MultiFab& enE_nodal_mf = *enE_nodal_scratch;
 
     // Loop through the grids, and over the tiles within each grid for the
     // initial, nodal calculation of E
@@ -925,7 +938,8 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
         }
 
         // Loop over the cells and update the nodal E field
-        amrex::ParallelFor(mfi.tilebox(), [=] AMREX_GPU_DEVICE (int i, int j, int k){
+        Box const tb = HybridPICModel::GetUpdateTileBox(mfi, IntVect::TheNodeVector(), ng_update, geom);
+        amrex::ParallelFor(tb, [=] AMREX_GPU_DEVICE (int i, int j, int k){
 
             // interpolate the total plasma current to a nodal grid
             auto const jx_interp = Interp(Jx, Jx_stag, nodal, coarsen, i, j, k, 0);
@@ -1021,9 +1035,9 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
         Real const * const AMREX_RESTRICT coefs_z = m_stencil_coefs_z.dataPtr();
         auto const n_coefs_z = static_cast<int>(m_stencil_coefs_z.size());
 
-        Box const& tex  = mfi.tilebox(Efield[0]->ixType().toIntVect());
-        Box const& tey  = mfi.tilebox(Efield[1]->ixType().toIntVect());
-        Box const& tez  = mfi.tilebox(Efield[2]->ixType().toIntVect());
+        Box const tex = HybridPICModel::GetUpdateTileBox(mfi, Efield[0]->ixType().toIntVect(), ng_update, geom);
+        Box const tey = HybridPICModel::GetUpdateTileBox(mfi, Efield[1]->ixType().toIntVect(), ng_update, geom);
+        Box const tez = HybridPICModel::GetUpdateTileBox(mfi, Efield[2]->ixType().toIntVect(), ng_update, geom);
 
         // Loop over the cells and update the E field
         amrex::ParallelFor(tex, tey, tez,
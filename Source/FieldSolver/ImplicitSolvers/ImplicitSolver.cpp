@@ -1,27 +1,83 @@
 #include "ImplicitSolver.H"
+#include "Fields.H"
 #include "WarpX.H"
 #include "Particles/MultiParticleContainer.H"
 
+#include <ablastr/warn_manager/WarnManager.H>
+
 using namespace amrex;
+using namespace amrex::literals;
 
 void ImplicitSolver::CreateParticleAttributes () const
 {
-    // Set comm to false to that the attributes are not communicated
-    // nor written to the checkpoint files
-    int const comm = 0;
-
-    // Add space to save the positions and velocities at the start of the time steps
+    // Add space to save the positions and velocities at the start of the time steps.
+    // These are set at the start of each step, so they need not follow the particles
+    // between steps (i.e., they are not communicated, sorted nor written to the checkpoint files)
     for (auto const& pc : m_WarpX->GetPartContainer()) {
 #if (AMREX_SPACEDIM >= 2)
-        pc->AddRealComp("x_n", comm);
+        pc->AddStepLocalRealComp("x_n");
 #endif
 #if defined(WARPX_DIM_3D) || defined(WARPX_DIM_RZ)
-        pc->AddRealComp("y_n", comm);
+        pc->AddStepLocalRealComp("y_n");
 #endif
-        pc->AddRealComp("z_n", comm);
-        pc->AddRealComp("ux_n", comm);
-        pc->AddRealComp("uy_n", comm);
-        pc->AddRealComp("uz_n", comm);
+        pc->AddStepLocalRealComp("z_n");
+        pc->AddStepLocalRealComp("ux_n");
+        pc->AddStepLocalRealComp("uy_n");
+        pc->AddStepLocalRealComp("uz_n");
+    }
+}
+
+void ImplicitSolver::DefineMassMatrices ( const amrex::ParmParse&  pp )
+{
+    pp.query("use_mass_matrices_jacobian", m_use_mass_matrices_jacobian);
+    pp.query("use_mass_matrices_pc", m_use_mass_matrices_pc);
+    if (!UseMassMatrices()) { return; }
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        m_nlsolver_type == NonlinearSolverType::Newton,
+        "implicit_evolve.use_mass_matrices_jacobian and use_mass_matrices_pc require the newton nonlinear solver");
+#if defined(WARPX_DIM_RZ)
+    WARPX_ABORT_WITH_MESSAGE("The implicit mass matrices are not implemented in RZ geometry");
+#endif
+    if (WarpX::use_filter) {
+        ablastr::warn_manager::WMRecordWarning("Implicit solver",
+            "The mass matrices do not include the current filter, so that the linearized current "
+            "is only an approximation of the filtered current.",
+            ablastr::warn_manager::WarnPriority::low);
+    }
+
+    using ablastr::fields::Direction;
+    using warpx::fields::FieldType;
+    for (int lev = 0; lev < m_num_amr_levels; ++lev) {
+        for (int dir = 0; dir < 3; ++dir) {
+            const MultiFab& Efp = *m_WarpX->m_fields.get(FieldType::Efield_fp, Direction{dir}, lev);
+            const MultiFab& Jfp = *m_WarpX->m_fields.get(FieldType::current_fp, Direction{dir}, lev);
+            m_WarpX->m_fields.alloc_init(FieldType::mass_matrix_diag, Direction{dir}, lev, Jfp.boxArray(),
+                                         Jfp.DistributionMap(), 1, Jfp.nGrowVect(), 0.0_rt);
+            m_WarpX->m_fields.alloc_init(FieldType::E_base, Direction{dir}, lev, Efp.boxArray(),
+                                         Efp.DistributionMap(), Efp.nComp(), Efp.nGrowVect(), 0.0_rt);
+            m_WarpX->m_fields.alloc_init(FieldType::J_base, Direction{dir}, lev, Jfp.boxArray(),
+                                         Jfp.DistributionMap(), Jfp.nComp(), Jfp.nGrowVect(), 0.0_rt);
+        }
+    }
+}
+
+void ImplicitSolver::PreRHSOp ( const amrex::Real  a_time,
+                                const int          a_nl_iter,
+                                const bool         a_from_jacobian )
+{
+    if (a_from_jacobian && m_use_mass_matrices_jacobian) {
+        // The particles are not pushed: J = J_base + M*(E - E_base)
+        m_WarpX->ImplicitLinearizedCurrent();
+        return;
+    }
+
+    m_WarpX->ImplicitPreRHSOp( a_time, m_dt, a_nl_iter, a_from_jacobian );
+
+    // The mass matrices are deposited once per nonlinear residual evaluation,
+    // i.e. once per Newton iteration, and then used by all the Krylov iterations
+    if (!a_from_jacobian && UseMassMatrices()) {
+        m_WarpX->ImplicitDepositMassMatrices( m_dt );
     }
 }
 
@@ -28,6 +28,12 @@ void SemiImplicitEM::Define ( WarpX*  a_WarpX )
     const amrex::ParmParse pp("implicit_evolve");
     parseNonlinearSolverParams( pp );
 
+    // Parse the mass matrices parameters and allocate the mass matrices
+    DefineMassMatrices( pp );
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        !m_use_mass_matrices_pc,
+        "implicit_evolve.use_mass_matrices_pc is only implemented for the theta_implicit_em solver");
+
     // Define the nonlinear solver
     m_nlsolver->Define(m_E, this);
     m_is_defined = true;
@@ -43,6 +49,7 @@ void SemiImplicitEM::PrintParameters () const
     amrex::Print() << "-----------------------------------------------------------\n";
     amrex::Print() << "max particle iterations:    " << m_max_particle_iterations << "\n";
     amrex::Print() << "particle tolerance:         " << m_particle_tolerance << "\n";
+    amrex::Print() << "mass matrices in Jacobian:  " << m_use_mass_matrices_jacobian << "\n";
     if (m_nlsolver_type==NonlinearSolverType::Picard) {
         amrex::Print() << "Nonlinear solver type:      Picard\n";
     }
@@ -114,7 +121,7 @@ void SemiImplicitEM::ComputeRHS ( WarpXSolverVec&  a_RHS,
 
     // Update particle positions and velocities using the current state
     // of Eg and Bg. Deposit current density at time n+1/2
-    m_WarpX->ImplicitPreRHSOp( half_time, m_dt, a_nl_iter, a_from_jacobian );
+    PreRHSOp( half_time, a_nl_iter, a_from_jacobian );
 
     // RHS = cvac^2*0.5*dt*( curl(Bg^{n+1/2}) - mu0*Jg^{n+1/2} )
     m_WarpX->ImplicitComputeRHSE(0.5_rt*m_dt, a_RHS);
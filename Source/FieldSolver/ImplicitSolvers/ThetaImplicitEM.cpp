@@ -7,6 +7,7 @@
 #include "Fields.H"
 #include "ThetaImplicitEM.H"
 #include "Diagnostics/ReducedDiags/MultiReducedDiags.H"
+#include "Utils/WarpXConst.H"
 #include "WarpX.H"
 
 using warpx::fields::FieldType;
@@ -49,6 +50,9 @@ void ThetaImplicitEM::Define ( WarpX* const  a_WarpX )
     // Parse nonlinear solver parameters
     parseNonlinearSolverParams( pp );
 
+    // Parse the mass matrices parameters and allocate the mass matrices
+    DefineMassMatrices( pp );
+
     // Define sigmaPC mutlifabs
     using ablastr::fields::Direction;
     for (int lev = 0; lev < m_num_amr_levels; ++lev) {
@@ -65,7 +69,7 @@ void ThetaImplicitEM::Define ( WarpX* const  a_WarpX )
     // Set the pointer to mass matrix MultiFab
     for (int lev = 0; lev < m_num_amr_levels; ++lev) {
         m_sigma_mfarrvec.push_back(m_WarpX->m_fields.get_alldirs(FieldType::sigmaPC, 0));
-        // setting m_sigma to 1.0 right now for testing
+        // sigma = 1 without the mass matrices, see UpdateSigmaPC otherwise
         for (int dim = 0; dim < 3; dim++) { m_sigma_mfarrvec[lev][dim]->setVal(1.0); }
     }
 
@@ -85,6 +89,8 @@ void ThetaImplicitEM::PrintParameters () const
     amrex::Print() << "Time-bias parameter theta:  " << m_theta << "\n";
     amrex::Print() << "max particle iterations:    " << m_max_particle_iterations << "\n";
     amrex::Print() << "particle tolerance:         " << m_particle_tolerance << "\n";
+    amrex::Print() << "mass matrices in Jacobian:  " << m_use_mass_matrices_jacobian << "\n";
+    amrex::Print() << "mass matrices in PC:        " << m_use_mass_matrices_pc << "\n";
     if (m_nlsolver_type==NonlinearSolverType::Picard) {
         amrex::Print() << "Nonlinear solver type:      Picard\n";
     }
@@ -154,7 +160,8 @@ void ThetaImplicitEM::ComputeRHS ( WarpXSolverVec&  a_RHS,
     // Update particle positions and velocities using the current state
     // of Eg and Bg. Deposit current density at time n+1/2
     const amrex::Real theta_time = start_time + m_theta*m_dt;
-    m_WarpX->ImplicitPreRHSOp( theta_time, m_dt, a_nl_iter, a_from_jacobian );
+    PreRHSOp( theta_time, a_nl_iter, a_from_jacobian );
+    if (!a_from_jacobian && m_use_mass_matrices_pc) { UpdateSigmaPC(); }
 
     // RHS = cvac^2*m_theta*dt*( curl(Bg^{n+theta}) - mu0*Jg^{n+1/2} )
     m_WarpX->ImplicitComputeRHSE( m_theta*m_dt, a_RHS);
@@ -188,3 +195,18 @@ void ThetaImplicitEM::FinishFieldUpdate ( amrex::Real end_time )
     m_WarpX->FinishMagneticFieldAndApplyBCs( B_old, m_theta, end_time );
 
 }
+
+void ThetaImplicitEM::UpdateSigmaPC ()
+{
+    // The Jacobian of the residual is I + (c*theta*dt)^2*curl(curl) + theta*dt/ep0*dJ/dE:
+    // sigma = 1 + theta*dt/ep0*M, with M the diagonal of the mass matrices
+    using ablastr::fields::Direction;
+    const amrex::Real coef = m_theta*m_dt/PhysConst::ep0;
+    for (int lev = 0; lev < m_num_amr_levels; ++lev) {
+        for (int dim = 0; dim < 3; dim++) {
+            const amrex::MultiFab& M = *m_WarpX->m_fields.get(FieldType::mass_matrix_diag, Direction{dim}, lev);
+            m_sigma_mfarrvec[lev][dim]->setVal(1.0_rt);
+            amrex::MultiFab::Saxpy(*m_sigma_mfarrvec[lev][dim], coef, M, 0, 0, 1, 0);
+        }
+    }
+}
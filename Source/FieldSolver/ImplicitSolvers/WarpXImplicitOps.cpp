@@ -69,6 +69,81 @@ WarpX::ImplicitPreRHSOp ( amrex::Real  a_cur_time,
 
 }
 
+void
+WarpX::ImplicitDepositMassMatrices ( amrex::Real  a_full_dt )
+{
+    WARPX_PROFILE("WarpX::ImplicitDepositMassMatrices()");
+
+    using namespace amrex::literals;
+    using ablastr::fields::Direction;
+    using warpx::fields::FieldType;
+
+    ablastr::fields::MultiLevelVectorField const mass_matrix =
+        m_fields.get_mr_levels_alldirs(FieldType::mass_matrix_diag, finest_level);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        for (int dir = 0; dir < 3; ++dir) { mass_matrix[lev][dir]->setVal(0._rt); }
+    }
+
+    // The particles are at time n+1/2, as left by the last call of ImplicitPreRHSOp.
+    // Laser particles do not respond to the fields and are skipped.
+    for (int isp = 0; isp < mypc->nSpecies(); ++isp) {
+        mypc->GetParticleContainer(isp).DepositMassMatrices(mass_matrix, a_full_dt);
+    }
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        SumBoundaryJ(mass_matrix, lev, Geom(lev).periodicity());
+
+        // Save the fields around which the current is linearized
+        for (int dir = 0; dir < 3; ++dir) {
+            const amrex::MultiFab& Efp = *m_fields.get(FieldType::Efield_fp, Direction{dir}, lev);
+            const amrex::MultiFab& Jfp = *m_fields.get(FieldType::current_fp, Direction{dir}, lev);
+            amrex::MultiFab& E_base = *m_fields.get(FieldType::E_base, Direction{dir}, lev);
+            amrex::MultiFab& J_base = *m_fields.get(FieldType::J_base, Direction{dir}, lev);
+            amrex::MultiFab::Copy(E_base, Efp, 0, 0, Efp.nComp(), E_base.nGrowVect());
+            amrex::MultiFab::Copy(J_base, Jfp, 0, 0, Jfp.nComp(), J_base.nGrowVect());
+        }
+    }
+}
+
+void
+WarpX::ImplicitLinearizedCurrent ()
+{
+    WARPX_PROFILE("WarpX::ImplicitLinearizedCurrent()");
+
+    using ablastr::fields::Direction;
+    using warpx::fields::FieldType;
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        for (int dir = 0; dir < 3; ++dir) {
+            amrex::MultiFab& Jfp = *m_fields.get(FieldType::current_fp, Direction{dir}, lev);
+            const amrex::MultiFab& Efp = *m_fields.get(FieldType::Efield_fp, Direction{dir}, lev);
+            const amrex::MultiFab& E_base = *m_fields.get(FieldType::E_base, Direction{dir}, lev);
+            const amrex::MultiFab& J_base = *m_fields.get(FieldType::J_base, Direction{dir}, lev);
+            const amrex::MultiFab& M = *m_fields.get(FieldType::mass_matrix_diag, Direction{dir}, lev);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+            for ( amrex::MFIter mfi(Jfp, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi )
+            {
+                amrex::Array4<amrex::Real> const& J = Jfp.array(mfi);
+                amrex::Array4<amrex::Real const> const& E = Efp.const_array(mfi);
+                amrex::Array4<amrex::Real const> const& E0 = E_base.const_array(mfi);
+                amrex::Array4<amrex::Real const> const& J0 = J_base.const_array(mfi);
+                amrex::Array4<amrex::Real const> const& m = M.const_array(mfi);
+
+                // J and E have the same staggering with the implicit (Yee) solvers
+                amrex::Box const& tb = mfi.tilebox();
+                amrex::ParallelFor(tb, Jfp.nComp(),
+                [=] AMREX_GPU_DEVICE (int i, int j, int k, int n)
+                {
+                    J(i,j,k,n) = J0(i,j,k,n) + m(i,j,k)*(E(i,j,k,n) - E0(i,j,k,n));
+                });
+            }
+        }
+    }
+}
+
 void
 WarpX::SetElectricFieldAndApplyBCs ( const WarpXSolverVec& a_E, amrex::Real a_time )
 {
@@ -7,6 +7,13 @@
 #include "FieldSolver/ImplicitSolvers/WarpXSolverVec.H"
 #include "WarpX.H"
 
+#include <AMReX_GpuContainers.H>
+#include <AMReX_MFParallelFor.H>
+#include <AMReX_Reduce.H>
+#include <AMReX_Tuple.H>
+
+#include <cmath>
+
 using warpx::fields::FieldType;
 
 WarpXSolverVec::~WarpXSolverVec ()
@@ -139,7 +146,127 @@ void WarpXSolverVec::Copy ( FieldType  a_array_type,
     }
 }
 
-[[nodiscard]] amrex::Real WarpXSolverVec::dotProduct ( const WarpXSolverVec&  a_X ) const
+amrex::Real WarpXSolverVec::dotProduct ( const WarpXSolverVec&  a_X ) const
+{
+    amrex::Real result = dotProductLocal(a_X);
+    amrex::ParallelAllReduce::Sum(result, amrex::ParallelContext::CommunicatorSub());
+    return result;
+}
+
+amrex::Vector<amrex::Real> WarpXSolverVec::multiDotProduct ( const amrex::Vector<const WarpXSolverVec*>&  a_X ) const
+{
+    amrex::Vector<amrex::Real> result(a_X.size());
+    for (int i = 0; i < static_cast<int>(a_X.size()); ++i) {
+        result[i] = dotProductLocal(*a_X[i]);
+    }
+    // a single reduction for all the dot products
+    amrex::ParallelAllReduce::Sum(result.data(), static_cast<int>(result.size()),
+                                  amrex::ParallelContext::CommunicatorSub());
+    return result;
+}
+
+amrex::Real WarpXSolverVec::linCombNorm2 ( const amrex::Real a, const WarpXSolverVec& X,
+                                           const amrex::Real b, const WarpXSolverVec& Y )
+{
+    assertIsDefined( X );
+    assertIsDefined( Y );
+    assertSameType( X );
+    assertSameType( Y );
+
+    amrex::ReduceOps<amrex::ReduceOpSum> reduce_op;
+    amrex::ReduceData<amrex::Real> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
+    auto linCombDot = [&] (amrex::MultiFab& dst, const amrex::MultiFab& x,
+                           const amrex::MultiFab& y, const amrex::iMultiFab& dotMask)
+    {
+        for (amrex::MFIter mfi(dst, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            const amrex::Box& bx = mfi.tilebox();
+            amrex::Array4<amrex::Real> const& d = dst.array(mfi);
+            amrex::Array4<amrex::Real const> const& xa = x.const_array(mfi);
+            amrex::Array4<amrex::Real const> const& ya = y.const_array(mfi);
+            amrex::Array4<int const> const& mask = dotMask.const_array(mfi);
+            reduce_op.eval(bx, reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+            {
+                const amrex::Real v = a*xa(i,j,k) + b*ya(i,j,k);
+                d(i,j,k) = v;
+                return { mask(i,j,k) ? v*v : amrex::Real(0.0) };
+            });
+        }
+    };
+
+    for (int lev = 0; lev < m_num_amr_levels; ++lev) {
+        if (m_array_type != FieldType::None) {
+            for (int n = 0; n < 3; ++n) {
+                const amrex::iMultiFab* dotMask = m_WarpX->getFieldDotMaskPointer(m_array_type, lev, ablastr::fields::Direction{n});
+                linCombDot(*m_array_vec[lev][n], *X.getArrayVec()[lev][n], *Y.getArrayVec()[lev][n], *dotMask);
+            }
+        }
+        if (m_scalar_type != FieldType::None) {
+            const amrex::iMultiFab* dotMask = m_WarpX->getFieldDotMaskPointer(m_scalar_type, lev, ablastr::fields::Direction{0});
+            linCombDot(*m_scalar_vec[lev], *X.getScalarVec()[lev], *Y.getScalarVec()[lev], *dotMask);
+        }
+    }
+
+    amrex::Real result = amrex::get<0>(reduce_data.value());
+    amrex::ParallelAllReduce::Sum(result, amrex::ParallelContext::CommunicatorSub());
+    return std::sqrt(result);
+}
+
+void WarpXSolverVec::multiIncrement ( const amrex::Vector<const WarpXSolverVec*>&  a_X,
+                                      const amrex::Vector<amrex::Real>&  a_a )
+{
+    AMREX_ALWAYS_ASSERT(a_X.size() == a_a.size());
+    const auto nvec = static_cast<int>(a_X.size());
+    if (nvec == 0) { return; }
+    for (auto const* X : a_X) {
+        assertIsDefined( *X );
+        assertSameType( *X );
+    }
+
+    amrex::Gpu::DeviceVector<amrex::Real> coefs(nvec);
+    amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, a_a.begin(), a_a.end(), coefs.begin());
+    const amrex::Real* AMREX_RESTRICT p_coefs = coefs.dataPtr();
+
+    // All the vectors are accumulated in a single pass over the valid cells of dst,
+    // instead of one Saxpy (that reads and writes dst) per vector
+    amrex::Vector<amrex::MultiArray4<amrex::Real const>> h_x(nvec);
+    amrex::Gpu::DeviceVector<amrex::MultiArray4<amrex::Real const>> d_x(nvec);
+    auto fusedIncrement = [&] (amrex::MultiFab& dst, auto const& get_x)
+    {
+        for (int v = 0; v < nvec; ++v) { h_x[v] = get_x(*a_X[v]).const_arrays(); }
+        amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, h_x.begin(), h_x.end(), d_x.begin());
+        auto const* AMREX_RESTRICT p_x = d_x.dataPtr();
+        auto const& d = dst.arrays();
+        amrex::ParallelFor(dst,
+        [=] AMREX_GPU_DEVICE (int b, int i, int j, int k)
+        {
+            amrex::Real sum = 0.0;
+            for (int v = 0; v < nvec; ++v) {
+                sum += p_coefs[v]*p_x[v][b](i,j,k);
+            }
+            d[b](i,j,k) += sum;
+        });
+        // h_x and d_x are reused for the next MultiFab
+        amrex::Gpu::streamSynchronize();
+    };
+
+    for (int lev = 0; lev < m_num_amr_levels; ++lev) {
+        if (m_array_type != FieldType::None) {
+            for (int n = 0; n < 3; ++n) {
+                fusedIncrement(*m_array_vec[lev][n],
+                    [=] (const WarpXSolverVec& X) -> amrex::MultiFab const& { return *X.getArrayVec()[lev][n]; });
+            }
+        }
+        if (m_scalar_type != FieldType::None) {
+            fusedIncrement(*m_scalar_vec[lev],
+                [=] (const WarpXSolverVec& X) -> amrex::MultiFab const& { return *X.getScalarVec()[lev]; });
+        }
+    }
+}
+
+amrex::Real WarpXSolverVec::dotProductLocal ( const WarpXSolverVec&  a_X ) const
 {
     assertIsDefined( a_X );
     assertSameType( a_X );
@@ -164,6 +291,5 @@ void WarpXSolverVec::Copy ( FieldType  a_array_type,
             result += rtmp;
         }
     }
-    amrex::ParallelAllReduce::Sum(result, amrex::ParallelContext::CommunicatorSub());
     return result;
 }
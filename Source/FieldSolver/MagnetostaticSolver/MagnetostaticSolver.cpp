@@ -123,8 +123,8 @@ WarpX::AddMagnetostaticFieldLabFrame()
     setVectorPotentialBC(m_fields.get_mr_levels_alldirs(FieldType::vector_potential_fp_nodal, finest_level));
 
     // Compute the vector potential A, by solving the Poisson equation
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE( !IsPythonCallbackInstalled("poissonsolver"),
-        "Python Level Poisson Solve not supported for Magnetostatic implementation.");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE( !IsCallbackInstalled("poissonsolver"),
+        "Python Level or native plugin Poisson Solve not supported for Magnetostatic implementation.");
 
     // const amrex::Real magnetostatic_absolute_tolerance = self_fields_absolute_tolerance*PhysConst::c;
     // temporary fix!!!
@@ -40,12 +40,17 @@
 #include <AMReX_FArrayBox.H>
 #include <AMReX_FabArray.H>
 #include <AMReX_Geometry.H>
+#include <AMReX_GpuContainers.H>
 #include <AMReX_GpuLaunch.H>
 #include <AMReX_GpuQualifiers.H>
+#include <AMReX_iMultiFab.H>
 #include <AMReX_IndexType.H>
+#include <AMReX_LayoutData.H>
 #include <AMReX_MFIter.H>
 #include <AMReX_Math.H>
 #include <AMReX_MultiFab.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Periodicity.H>
 #include <AMReX_REAL.H>
 #include <AMReX_Vector.H>
 
@@ -891,11 +896,176 @@ WarpX::PushPSATD (amrex::Real start_time)
 #endif
 }
 
+namespace {
+    /** Set *flag to 1 if mf is non-zero in the valid box of mfi, stopping at the first non-zero value */
+    void FlagNonZeroBox (amrex::MultiFab const& mf, amrex::MFIter const& mfi, int* flag)
+    {
+        using namespace amrex::literals;
+
+        amrex::Array4<amrex::Real const> const& arr = mf.const_array(mfi);
+        amrex::Box const& box = mf.box(mfi.index());
+#ifdef AMREX_USE_GPU
+        amrex::ParallelFor(box,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                // once a non-zero value is found, the other threads only read the flag
+                if (*flag == 0 && arr(i,j,k) != 0._rt) { *flag = 1; }
+            });
+#else
+        if (*flag) { return; }
+        amrex::Dim3 const lo = amrex::lbound(box);
+        amrex::Dim3 const hi = amrex::ubound(box);
+        for (int k = lo.z; k <= hi.z; ++k) {
+            for (int j = lo.y; j <= hi.y; ++j) {
+                for (int i = lo.x; i <= hi.x; ++i) {
+                    if (arr(i,j,k) != 0._rt) { *flag = 1; return; }
+                }
+            }
+        }
+#endif
+    }
+}
+
+void
+WarpX::UpdateActiveFieldBoxes ()
+{
+    WARPX_PROFILE("WarpX::UpdateActiveFieldBoxes()");
+
+    using ablastr::fields::Direction;
+
+    // The callbacks called in the middle of the field solve may set fields to
+    // non-zero values in any box, which must then all be updated
+    if (IsCallbackInstalled("afterBpush") || IsCallbackInstalled("afterEpush")) {
+        ClearActiveFieldBoxes();
+        return;
+    }
+
+    // Within one step, the field solve has at most 7 successive updates
+    // (F, G, B, E, F, G, B), each of which can move non-zero values by one cell,
+    // and the finite-difference stencils read one more cell
+    constexpr int n_margin = 8;
+
+    m_active_field_boxes.resize(finest_level+1);
+    m_field_box_state.resize(finest_level+1);
+    m_field_box_flags.resize(finest_level+1);
+
+    for (int lev = 0; lev <= finest_level; ++lev)
+    {
+        amrex::BoxArray const& ba = boxArray(lev);
+        amrex::DistributionMapping const& dm = DistributionMap(lev);
+
+        // Fields used by the field solve
+        amrex::Vector<amrex::MultiFab const*> fields;
+        for (int idim = 0; idim < 3; ++idim) {
+            fields.push_back(m_fields.get(FieldType::Efield_fp, Direction{idim}, lev));
+            fields.push_back(m_fields.get(FieldType::Bfield_fp, Direction{idim}, lev));
+            fields.push_back(m_fields.get(FieldType::current_fp, Direction{idim}, lev));
+        }
+        if (m_fields.has(FieldType::F_fp, lev)) { fields.push_back(m_fields.get(FieldType::F_fp, lev)); }
+        if (m_fields.has(FieldType::G_fp, lev)) { fields.push_back(m_fields.get(FieldType::G_fp, lev)); }
+
+        // The flags of the boxes are shared with their neighbors through the guard cells
+        // of an iMultiFab, coarsened as much as possible, with one cell per box at best
+        int ratio = 8;
+        while (ratio > 1 && !(ba.coarsenable(ratio) && Geom(lev).Domain().coarsenable(ratio))) {
+            ratio /= 2;
+        }
+        int const ng_flags = (n_margin + ratio - 1) / ratio;
+
+        // The state is reset when the grids change (regrid, load balance) or
+        // when the fields are shifted by the moving window
+        if (!m_field_box_state[lev] ||
+            m_field_box_state[lev]->boxArray() != ba ||
+            m_field_box_state[lev]->DistributionMap() != dm)
+        {
+            m_field_box_state[lev] = std::make_unique<amrex::LayoutData<int>>(ba, dm);
+            for (int const ibox : m_field_box_state[lev]->IndexArray()) {
+                (*m_field_box_state[lev])[ibox] = 0;
+            }
+            m_field_box_flags[lev] = std::make_unique<amrex::iMultiFab>(
+                amrex::coarsen(ba, ratio), dm, 1, ng_flags);
+        }
+        amrex::LayoutData<int>& state = *m_field_box_state[lev];
+        amrex::iMultiFab& flags = *m_field_box_flags[lev];
+
+        // Flag the local boxes in which any of the fields is non-zero. The boxes already
+        // known to be non-zero are not scanned again: they remain updated at every step,
+        // which is always correct. All the fields are scanned in the other boxes, since
+        // they can also be set outside of the field solve (callbacks, boundaries, resets).
+        int const nlocal = flags.local_size();
+        amrex::Vector<int> nonzero_h(nlocal);
+        for (amrex::MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            nonzero_h[mfi.LocalIndex()] = state[mfi.index()];
+        }
+        amrex::Gpu::DeviceVector<int> nonzero_d(nlocal);
+        amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, nonzero_h.begin(), nonzero_h.end(), nonzero_d.begin());
+        int* const nonzero_ptr = nonzero_d.data();
+        for (amrex::MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            if (state[mfi.index()]) { continue; }
+            int* const flag = nonzero_ptr + mfi.LocalIndex();
+            for (auto const* mf : fields) { FlagNonZeroBox(*mf, mfi, flag); }
+        }
+        amrex::Gpu::copyAsync(amrex::Gpu::deviceToHost, nonzero_d.begin(), nonzero_d.end(), nonzero_h.begin());
+        amrex::Gpu::streamSynchronize();
+
+        flags.setVal(0);
+        for (amrex::MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            if (nonzero_h[mfi.LocalIndex()]) {
+                flags[mfi].setVal<amrex::RunOn::Device>(1, mfi.validbox());
+            }
+        }
+        flags.FillBoundary(Geom(lev).periodicity(amrex::coarsen(Geom(lev).Domain(), ratio)));
+
+        // A box is active if any box within the margin is non-zero. The margin must
+        // also be covered by the boxes of the level, periodic images included on level 0,
+        // otherwise fields could come from outside the level (PML, coarser level).
+        amrex::Box const domain = (lev == 0) ?
+            Geom(lev).growPeriodicDomain(n_margin) : Geom(lev).Domain();
+
+        amrex::Vector<int> active_h(nlocal);
+        for (amrex::MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            amrex::Box const grown_box = amrex::grow(ba[mfi.index()], n_margin);
+            active_h[mfi.LocalIndex()] = (domain.contains(grown_box) &&
+                                          (lev == 0 || ba.contains(grown_box))) ? 0 : 1;
+        }
+        amrex::Gpu::DeviceVector<int> active_d(nlocal);
+        amrex::Gpu::copyAsync(amrex::Gpu::hostToDevice, active_h.begin(), active_h.end(), active_d.begin());
+        int* const active_ptr = active_d.data();
+        for (amrex::MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            if (active_h[mfi.LocalIndex()]) { continue; }
+            int* const flag = active_ptr + mfi.LocalIndex();
+            amrex::Array4<int const> const& flags_arr = flags.const_array(mfi);
+            amrex::ParallelFor(amrex::grow(mfi.validbox(), ng_flags),
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                {
+                    if (flags_arr(i,j,k)) { *flag = 1; }
+                });
+        }
+        amrex::Gpu::copyAsync(amrex::Gpu::deviceToHost, active_d.begin(), active_d.end(), active_h.begin());
+        amrex::Gpu::streamSynchronize();
+
+        m_active_field_boxes[lev] = std::make_unique<amrex::LayoutData<int>>(ba, dm);
+        amrex::LayoutData<int>& active = *m_active_field_boxes[lev];
+        for (amrex::MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            int const li = mfi.LocalIndex();
+            active[mfi.index()] = active_h[li];
+            state[mfi.index()] = nonzero_h[li];
+        }
+    }
+}
+
+void
+WarpX::ClearActiveFieldBoxes ()
+{
+    m_active_field_boxes.clear();
+}
+
 void
-WarpX::EvolveB (amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time)
+WarpX::EvolveB (amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time,
+                amrex::IntVect const& ng_update)
 {
     for (int lev = 0; lev <= finest_level; ++lev) {
-        EvolveB(lev, a_dt, a_dt_type, start_time);
+        EvolveB(lev, a_dt, a_dt_type, start_time, ng_update);
     }
 
     // Allow execution of Python callback after B-field push
@@ -903,30 +1073,34 @@ WarpX::EvolveB (amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time)
 }
 
 void
-WarpX::EvolveB (int lev, amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time)
+WarpX::EvolveB (int lev, amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time,
+                amrex::IntVect const& ng_update)
 {
     WARPX_PROFILE("WarpX::EvolveB()");
-    EvolveB(lev, PatchType::fine, a_dt, a_dt_type, start_time);
+    EvolveB(lev, PatchType::fine, a_dt, a_dt_type, start_time, ng_update);
     if (lev > 0)
     {
-        EvolveB(lev, PatchType::coarse, a_dt, a_dt_type, start_time);
+        EvolveB(lev, PatchType::coarse, a_dt, a_dt_type, start_time, ng_update);
     }
 }
 
 void
-WarpX::EvolveB (int lev, PatchType patch_type, amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time)
+WarpX::EvolveB (int lev, PatchType patch_type, amrex::Real a_dt, DtType a_dt_type, amrex::Real start_time,
+                amrex::IntVect const& ng_update)
 {
     // Evolve B field in regular cells
     if (patch_type == PatchType::fine) {
         m_fdtd_solver_fp[lev]->EvolveB( m_fields,
                                         lev,
                                         patch_type,
-                                        m_flag_info_face[lev], m_borrowing[lev], a_dt );
+                                        m_flag_info_face[lev], m_borrowing[lev], a_dt,
+                                        ng_update );
     } else {
         m_fdtd_solver_cp[lev]->EvolveB( m_fields,
                                         lev,
                                         patch_type,
-                                        m_flag_info_face[lev], m_borrowing[lev], a_dt );
+                                        m_flag_info_face[lev], m_borrowing[lev], a_dt,
+                                        ng_update );
     }
 
     // Evolve B field in PML cells
@@ -18,6 +18,9 @@
 #include "WarpX.H"
 
 #include <ablastr/fields/MultiFabRegister.H>
+#include <ablastr/utils/Communication.H>
+
+#include <algorithm>
 
 
 using namespace amrex;
@@ -29,10 +32,13 @@ void WarpX::HybridPICEvolveFields ()
 
     WARPX_PROFILE("WarpX::HybridPICEvolveFields()");
 
-    // The below deposition is hard coded for a single level simulation
+    // The fluid deposition below is hard coded for a single level simulation
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        finest_level == 0 || !do_fluid_species,
+        "Ohm's law E-solve with fluid species only works with a single level.");
     WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
-        finest_level == 0,
-        "Ohm's law E-solve only works with a single level.");
+        finest_level == 0 || !m_hybrid_pic_model->m_use_deep_halo,
+        "hybrid_pic_model.use_deep_halo only works with a single level.");
 
     // Get requested number of substeps to use
     const int sub_steps = m_hybrid_pic_model->m_substeps;
@@ -81,6 +87,12 @@ void WarpX::HybridPICEvolveFields ()
     // and apply boundary conditions
     SyncCurrentAndRho();
 
+    // With mesh refinement, the charge and current densities of the finer
+    // levels are interpolated from the level below near the edge of the fine patch
+    HybridPICInterpolateSourcesFromCoarseLevel(
+        m_fields.get_mr_levels(FieldType::rho_fp, finest_level),
+        m_fields.get_mr_levels_alldirs(FieldType::current_fp, finest_level));
+
     // SyncCurrent does not include a call to FillBoundary, but it is needed
     // for the hybrid-PIC solver since current values are interpolated to
     // a nodal grid
@@ -90,6 +102,16 @@ void WarpX::HybridPICEvolveFields ()
         }
     }
 
+    // With deep halos, the fields are calculated in the guard cells during the
+    // substeps, which thus need the charge density in all the guard cells
+    const bool use_deep_halo = m_hybrid_pic_model->m_use_deep_halo;
+    if (use_deep_halo) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            m_fields.get(FieldType::rho_fp, lev)->FillBoundary(Geom(lev).periodicity());
+            m_fields.get(FieldType::hybrid_rho_fp_temp, lev)->FillBoundary(Geom(lev).periodicity());
+        }
+    }
+
     // Get the external current
     m_hybrid_pic_model->GetCurrentExternal();
 
@@ -125,6 +147,7 @@ void WarpX::HybridPICEvolveFields ()
     // Push the B field from t=n to t=n+1/2 using the current and density
     // at t=n, while updating the E field along with B using the electron
     // momentum equation
+    m_hybrid_pic_model->FillBoundaryDeepHalo(WarpX::sync_nodal_points, true);
     for (int sub_step = 0; sub_step < sub_steps; sub_step++)
     {
         m_hybrid_pic_model->BfieldEvolveRK(
@@ -137,6 +160,7 @@ void WarpX::HybridPICEvolveFields ()
             WarpX::sync_nodal_points
         );
     }
+    m_hybrid_pic_model->FillBoundaryDeepHalo(WarpX::sync_nodal_points);
 
     // Average rho^{n} and rho^{n+1} to get rho^{n+1/2} in rho_fp_temp
     for (int lev = 0; lev <= finest_level; ++lev)
@@ -158,6 +182,7 @@ void WarpX::HybridPICEvolveFields ()
     }
 
     // Now push the B field from t=n+1/2 to t=n+1 using the n+1/2 quantities
+    m_hybrid_pic_model->FillBoundaryDeepHalo(WarpX::sync_nodal_points, true);
     for (int sub_step = 0; sub_step < sub_steps; sub_step++)
     {
         m_hybrid_pic_model->BfieldEvolveRK(
@@ -171,6 +196,7 @@ void WarpX::HybridPICEvolveFields ()
             WarpX::sync_nodal_points
         );
     }
+    m_hybrid_pic_model->FillBoundaryDeepHalo(WarpX::sync_nodal_points);
 
     // Extrapolate the ion current density to t=n+1 using
     // J_i^{n+1} = 1/2 * J_i^{n-1/2} + 3/2 * J_i^{n+1/2}, and recalling that
@@ -210,6 +236,9 @@ void WarpX::HybridPICEvolveFields ()
         m_fields.get_mr_levels(FieldType::rho_fp, finest_level),
         m_eb_update_E, false);
     FillBoundaryE(guard_cells.ng_FieldSolver, WarpX::sync_nodal_points);
+    m_hybrid_pic_model->SyncFieldAcrossLevels(
+        m_fields.get_mr_levels_alldirs(FieldType::Efield_fp, finest_level),
+        guard_cells.ng_FieldSolver, WarpX::sync_nodal_points);
 
     // Handle field splitting for Hybrid field push
     if (add_external_fields) {
@@ -244,6 +273,26 @@ void WarpX::HybridPICEvolveFields ()
         }
     }
 
+    // The fields of the coarse patches are only used to update the auxiliary
+    // fields, i.e. aux(lev) = fp(lev) + I(aux(lev-1) - cp(lev)). Since the fields
+    // are solved for on each level, with the guard cells of the finer levels
+    // interpolated from the coarser levels, they are set so that aux(lev) = fp(lev).
+    for (int lev = 1; lev <= finest_level; ++lev)
+    {
+        for (int idim = 0; idim < 3; ++idim) {
+            amrex::MultiFab* E_cp = m_fields.get(FieldType::Efield_cp, Direction{idim}, lev);
+            amrex::MultiFab* B_cp = m_fields.get(FieldType::Bfield_cp, Direction{idim}, lev);
+            ablastr::utils::communication::ParallelCopy(
+                *E_cp, *m_fields.get(FieldType::Efield_fp, Direction{idim}, lev-1), 0, 0, E_cp->nComp(),
+                guard_cells.ng_FieldGather, E_cp->nGrowVect(), WarpX::do_single_precision_comms,
+                Geom(lev-1).periodicity());
+            ablastr::utils::communication::ParallelCopy(
+                *B_cp, *m_fields.get(FieldType::Bfield_fp, Direction{idim}, lev-1), 0, 0, B_cp->nComp(),
+                guard_cells.ng_FieldGather, B_cp->nGrowVect(), WarpX::do_single_precision_comms,
+                Geom(lev-1).periodicity());
+        }
+    }
+
     // Check that the E-field does not have nan or inf values, otherwise print a clear message
     ablastr::fields::MultiLevelVectorField Efield_fp = m_fields.get_mr_levels_alldirs(FieldType::Efield_fp, finest_level);
     for (int lev = 0; lev <= finest_level; ++lev)
@@ -269,6 +318,7 @@ void WarpX::HybridPICDepositInitialRhoAndJ ()
     mypc->DepositCurrent(current_fp_temp, dt[0], 0._rt);
     SyncRho(rho_fp_temp, m_fields.get_mr_levels(FieldType::rho_cp, finest_level, skip_lev0_coarse_patch), m_fields.get_mr_levels(FieldType::rho_buf, finest_level, skip_lev0_coarse_patch));
     SyncCurrent("hybrid_current_fp_temp");
+    HybridPICInterpolateSourcesFromCoarseLevel(rho_fp_temp, current_fp_temp);
     for (int lev=0; lev <= finest_level; ++lev) {
         // SyncCurrent does not include a call to FillBoundary, but it is needed
         // for the hybrid-PIC solver since current values are interpolated to
@@ -288,6 +338,29 @@ void WarpX::HybridPICDepositInitialRhoAndJ ()
     }
 }
 
+void WarpX::HybridPICInterpolateSourcesFromCoarseLevel (
+    ablastr::fields::MultiLevelScalarField const& rho,
+    ablastr::fields::MultiLevelVectorField const& current)
+{
+    if (finest_level == 0) { return; }
+
+    WARPX_PROFILE("WarpX::HybridPICInterpolateSourcesFromCoarseLevel()");
+
+    // Cells of the fine patch to which the particles that deposit on the
+    // coarser level can contribute: the current deposition buffer, widened
+    // by the extent of the particle shape
+    const int n_interior = std::max(n_current_deposition_buffer, 0)
+        + std::max(guard_cells.ng_depos_J.max(), guard_cells.ng_depos_rho.max());
+
+    for (int lev = 1; lev <= finest_level; ++lev)
+    {
+        InterpolateFromCoarseLevel(*rho[lev], *rho[lev-1], lev, n_interior);
+        for (int idim = 0; idim < 3; ++idim) {
+            InterpolateFromCoarseLevel(*current[lev][idim], *current[lev-1][idim], lev, n_interior);
+        }
+    }
+}
+
 void
 WarpX::CalculateExternalCurlA() {
     WARPX_PROFILE("WarpX::CalculateExternalCurlA()");
@@ -11,6 +11,7 @@
 #include "MusclHancockUtils.H"
 #include "Fluids/WarpXFluidContainer.H"
 #include "Utils/Parser/ParserUtils.H"
+#include "Utils/ScratchMultiFabPool.H"
 #include "Utils/WarpXUtil.H"
 #include "Utils/SpeciesUtils.H"
 #include "WarpX.H"
@@ -18,6 +19,10 @@
 #include <ablastr/coarsen/sample.H>
 #include <ablastr/utils/Communication.H>
 
+#include <AMReX_FArrayBox.H>
+
+#include <algorithm>
+
 using namespace ablastr::utils::communication;
 using namespace amrex;
 
@@ -161,6 +166,11 @@ void WarpXFluidContainer::AllocateLevelMFs(ablastr::fields::MultiFabRegister& fi
             name_mf_NU, Direction{2}, lev, amrex::convert(ba, amrex::IntVect::TheNodeVector()), dm,
             ncomps, nguards, 0.0_rt);
 
+    // Updated N and NU (4 components) in the MUSCL-Hancock advective push
+    fields.alloc_init(
+            name_mf_U_new, lev, amrex::convert(ba, amrex::IntVect::TheNodeVector()), dm,
+            4, amrex::IntVect(0), 0.0_rt);
+
 }
 
 void WarpXFluidContainer::InitData(ablastr::fields::MultiFabRegister& fields, amrex::Box init_box, amrex::Real cur_time, int lev)
@@ -451,44 +461,31 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
     const amrex::Real dt_over_dz_half = 0.5_rt*(dt/dx[0]);
 #endif
 
-    const amrex::BoxArray ba = fields.get(name_mf_N, lev)->boxArray();
-
-    // Temporary Half-step values
-#if defined(WARPX_DIM_3D)
-    amrex::MultiFab tmp_U_minus_x( amrex::convert(ba, IntVect(0,1,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_x( amrex::convert(ba, IntVect(0,1,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_minus_y( amrex::convert(ba, IntVect(1,0,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_y( amrex::convert(ba, IntVect(1,0,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_minus_z( amrex::convert(ba, IntVect(1,1,0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_z( amrex::convert(ba, IntVect(1,1,0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
-    amrex::MultiFab tmp_U_minus_x( amrex::convert(ba, IntVect(0,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_x( amrex::convert(ba, IntVect(0,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_minus_z( amrex::convert(ba, IntVect(1,0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_z( amrex::convert(ba, IntVect(1,0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-#else
-    amrex::MultiFab tmp_U_minus_z( amrex::convert(ba, IntVect(0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_z( amrex::convert(ba, IntVect(0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-#endif
+    // Updated N and NU, written in a separate persistent MultiFab so that the
+    // fused kernels of neighboring tiles still read N and NU at time n
+    amrex::MultiFab& U_new_mf = *fields.get(name_mf_U_new, lev);
 
-    // Fill edge values of N and U at the half timestep for MUSCL
+    // Fused MUSCL-Hancock update: for each tile, the slopes and the edge values
+    // of N and U at the half timestep are computed in small tile-local scratch
+    // arrays, which are then directly used to compute the fluxes
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for (MFIter mfi(*fields.get(name_mf_N, lev), TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
 
-        // Loop over a box with one extra gridpoint in the ghost region to avoid
-        // an extra MPI communication between the edge value computation loop and
-        // the flux calculation loop
+        // Loop over a box with one extra gridpoint around the tile, so that
+        // the edge values needed by the flux calculation of all the points
+        // of the tile are available without any MPI communication.
+        // (growntilebox would only grow the tile at the faces of the valid box,
+        // while the scratch arrays are local to the tile: grow all its faces.)
         const amrex::Box tile_box = [&](){
-            auto tt = mfi.growntilebox(1);
+            auto tt = amrex::grow(mfi.tilebox(), 1);
 #if defined (WARPX_DIM_RZ)
             // Limit the grown box for RZ at r = 0, r_max
             const int idir = 0;
-            const int n_cell = -1;
-            tt.growLo(idir, n_cell);
-            tt.growHi(idir, n_cell);
+            tt.setSmall(idir, std::max(tt.smallEnd(idir), mfi.validbox().smallEnd(idir)));
+            tt.setBig(idir, std::min(tt.bigEnd(idir), mfi.validbox().bigEnd(idir)));
 #endif
            return tt;
         }();
@@ -503,36 +500,63 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
         amrex::Box box = mfi.validbox();
         box.grow(1);
 #if defined(WARPX_DIM_3D)
-        amrex::Box const box_x = amrex::convert( box, tmp_U_minus_x.ixType() );
-        amrex::Box const box_y = amrex::convert( box, tmp_U_minus_y.ixType() );
-        amrex::Box const box_z = amrex::convert( box, tmp_U_minus_z.ixType() );
+        const amrex::IntVect ix_x(0,1,1);
+        const amrex::IntVect ix_y(1,0,1);
+        const amrex::IntVect ix_z(1,1,0);
+#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
+        const amrex::IntVect ix_x(0,1);
+        const amrex::IntVect ix_z(1,0);
+#else
+        const amrex::IntVect ix_z(0);
+#endif
+
+#if defined(WARPX_DIM_3D)
+        amrex::Box const box_x = amrex::convert( box, ix_x );
+        amrex::Box const box_y = amrex::convert( box, ix_y );
+        amrex::Box const box_z = amrex::convert( box, ix_z );
 #elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
-        amrex::Box const box_x = amrex::convert( box, tmp_U_minus_x.ixType() );
-        amrex::Box const box_z = amrex::convert( box, tmp_U_minus_z.ixType() );
+        amrex::Box const box_x = amrex::convert( box, ix_x );
+        amrex::Box const box_z = amrex::convert( box, ix_z );
 #else
-        amrex::Box const box_z = amrex::convert( box, tmp_U_minus_z.ixType() );
+        amrex::Box const box_z = amrex::convert( box, ix_z );
 #endif
 
-        //N and NU are always defined at the nodes, the tmp_Q_* are defined
+        //N and NU are always defined at the nodes, the U_* are defined
         //in between the nodes (i.e. on the staggered Yee grid) and store the
         //values of N and U at these points.
         //(i.e. the 4 components correspond to N + the 3 components of U)
-        // Extract the temporary arrays for edge values
+        // The edge values are only needed within the tile: they are stored in
+        // tile-local scratch arrays, allocated from the asynchronous arena
+        // (a memory pool, which avoids any allocation in the steady state)
+        // and which stay in cache on CPU
+        const amrex::Box scratch_box = amrex::grow(tile_box, 1);
 #if defined(WARPX_DIM_3D)
-        const amrex::Array4<amrex::Real> U_minus_x = tmp_U_minus_x.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_x = tmp_U_plus_x.array(mfi);
-        const amrex::Array4<amrex::Real> U_minus_y = tmp_U_minus_y.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_y = tmp_U_plus_y.array(mfi);
-        const amrex::Array4<amrex::Real> U_minus_z = tmp_U_minus_z.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_z = tmp_U_plus_z.array(mfi);
+        amrex::FArrayBox U_minus_x_fab(amrex::convert(scratch_box, ix_x), 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_x_fab(amrex::convert(scratch_box, ix_x), 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_minus_y_fab(amrex::convert(scratch_box, ix_y), 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_y_fab(amrex::convert(scratch_box, ix_y), 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_minus_z_fab(amrex::convert(scratch_box, ix_z), 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_z_fab(amrex::convert(scratch_box, ix_z), 4, amrex::The_Async_Arena());
+        const amrex::Array4<amrex::Real> U_minus_x = U_minus_x_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_x = U_plus_x_fab.array();
+        const amrex::Array4<amrex::Real> U_minus_y = U_minus_y_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_y = U_plus_y_fab.array();
+        const amrex::Array4<amrex::Real> U_minus_z = U_minus_z_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_z = U_plus_z_fab.array();
 #elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
-        const amrex::Array4<amrex::Real> U_minus_x = tmp_U_minus_x.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_x = tmp_U_plus_x.array(mfi);
-        const amrex::Array4<amrex::Real> U_minus_z = tmp_U_minus_z.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_z = tmp_U_plus_z.array(mfi);
+        amrex::FArrayBox U_minus_x_fab(amrex::convert(scratch_box, ix_x), 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_x_fab(amrex::convert(scratch_box, ix_x), 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_minus_z_fab(amrex::convert(scratch_box, ix_z), 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_z_fab(amrex::convert(scratch_box, ix_z), 4, amrex::The_Async_Arena());
+        const amrex::Array4<amrex::Real> U_minus_x = U_minus_x_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_x = U_plus_x_fab.array();
+        const amrex::Array4<amrex::Real> U_minus_z = U_minus_z_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_z = U_plus_z_fab.array();
 #else
-        const amrex::Array4<amrex::Real> U_minus_z = tmp_U_minus_z.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_z = tmp_U_plus_z.array(mfi);
+        amrex::FArrayBox U_minus_z_fab(amrex::convert(scratch_box, ix_z), 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_z_fab(amrex::convert(scratch_box, ix_z), 4, amrex::The_Async_Arena());
+        const amrex::Array4<amrex::Real> U_minus_z = U_minus_z_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_z = U_plus_z_fab.array();
 #endif
 
         amrex::ParallelFor(tile_box,
@@ -752,38 +776,12 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
                 }
             }
         );
-    }
-
-    // Given the values of `U_minus` and `U_plus`, compute fluxes in between nodes, and update N, NU accordingly
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
-#endif
-    for (MFIter mfi(*fields.get(name_mf_N, lev), TilingIfNotGPU()); mfi.isValid(); ++mfi)
-    {
-        const amrex::Box tile_box = mfi.tilebox(fields.get(name_mf_N, lev)->ixType().toIntVect());
-        const amrex::Array4<Real> N_arr = fields.get(name_mf_N, lev)->array(mfi);
-        const amrex::Array4<Real> NUx_arr = fields.get(name_mf_NU, Direction{0}, lev)->array(mfi);
-        const amrex::Array4<Real> NUy_arr = fields.get(name_mf_NU, Direction{1}, lev)->array(mfi);
-        const amrex::Array4<Real> NUz_arr = fields.get(name_mf_NU, Direction{2}, lev)->array(mfi);
-
-#if defined(WARPX_DIM_3D)
-        amrex::Array4<amrex::Real> const &U_minus_x = tmp_U_minus_x.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_x = tmp_U_plus_x.array(mfi);
-        amrex::Array4<amrex::Real> const &U_minus_y = tmp_U_minus_y.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_y = tmp_U_plus_y.array(mfi);
-        amrex::Array4<amrex::Real> const &U_minus_z = tmp_U_minus_z.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_z = tmp_U_plus_z.array(mfi);
-#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
-        amrex::Array4<amrex::Real> const &U_minus_x = tmp_U_minus_x.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_x = tmp_U_plus_x.array(mfi);
-        amrex::Array4<amrex::Real> const &U_minus_z = tmp_U_minus_z.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_z = tmp_U_plus_z.array(mfi);
-#else
-        amrex::Array4<amrex::Real> const &U_minus_z = tmp_U_minus_z.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_z = tmp_U_plus_z.array(mfi);
-#endif
 
-        amrex::ParallelFor(tile_box,
+        // Given the values of `U_minus` and `U_plus`, compute fluxes in between nodes,
+        // and the updated N, NU on the tile
+        const amrex::Box update_box = mfi.tilebox(fields.get(name_mf_N, lev)->ixType().toIntVect());
+        const amrex::Array4<amrex::Real> U_new = U_new_mf.array(mfi);
+        amrex::ParallelFor(update_box,
             [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
             {
 
@@ -791,29 +789,29 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
 #if defined(WARPX_DIM_3D)
 
                 // Update the conserved variables Q = [N, NU] from tn -> tn + dt
-                N_arr(i,j,k) = N_arr(i,j,k)  - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,0,0)
+                U_new(i,j,k,0) = N_arr(i,j,k)  - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,0,0)
                                              - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,0,1)
                                              - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
-                NUx_arr(i,j,k) = NUx_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,1,0)
+                U_new(i,j,k,1) = NUx_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,1,0)
                                                 - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,1,1)
                                                 - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
-                NUy_arr(i,j,k) = NUy_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,2,0)
+                U_new(i,j,k,2) = NUy_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,2,0)
                                                 - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,2,1)
                                                 - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
-                NUz_arr(i,j,k) = NUz_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,3,0)
+                U_new(i,j,k,3) = NUz_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,3,0)
                                                 - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,3,1)
                                                 - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
 
 #elif defined(WARPX_DIM_XZ)
 
                 // Update the conserved variables Q = [N, NU] from tn -> tn + dt
-                N_arr(i,j,k) = N_arr(i,j,k)  - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,0,0)
+                U_new(i,j,k,0) = N_arr(i,j,k)  - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,0,0)
                                              - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
-                NUx_arr(i,j,k) = NUx_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,1,0)
+                U_new(i,j,k,1) = NUx_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,1,0)
                                                 - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
-                NUy_arr(i,j,k) = NUy_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,2,0)
+                U_new(i,j,k,2) = NUy_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,2,0)
                                                 - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
-                NUz_arr(i,j,k) = NUz_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,3,0)
+                U_new(i,j,k,3) = NUz_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,3,0)
                                                 - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
 
 #elif defined(WARPX_DIM_RZ)
@@ -874,22 +872,28 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
                 }
 
                 // Update the conserved variables from tn -> tn + dt
-                N_arr(i,j,k) = N_arr(i,j,k)     - (dt/Vij)*(F0_plusx - F0_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,0,2)*S_Az);
-                NUx_arr(i,j,k) = NUx_arr(i,j,k) - (dt/Vij)*(F1_plusx - F1_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,1,2)*S_Az);
-                NUy_arr(i,j,k) = NUy_arr(i,j,k) - (dt/Vij)*(F2_plusx - F2_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,2,2)*S_Az);
-                NUz_arr(i,j,k) = NUz_arr(i,j,k) - (dt/Vij)*(F3_plusx - F3_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,3,2)*S_Az);
+                U_new(i,j,k,0) = N_arr(i,j,k)     - (dt/Vij)*(F0_plusx - F0_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,0,2)*S_Az);
+                U_new(i,j,k,1) = NUx_arr(i,j,k) - (dt/Vij)*(F1_plusx - F1_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,1,2)*S_Az);
+                U_new(i,j,k,2) = NUy_arr(i,j,k) - (dt/Vij)*(F2_plusx - F2_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,2,2)*S_Az);
+                U_new(i,j,k,3) = NUz_arr(i,j,k) - (dt/Vij)*(F3_plusx - F3_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,3,2)*S_Az);
 
 #else
 
                 // Update the conserved variables Q = [N, NU] from tn -> tn + dt
-                N_arr(i,j,k) = N_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
-                NUx_arr(i,j,k) = NUx_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
-                NUy_arr(i,j,k) = NUy_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
-                NUz_arr(i,j,k) = NUz_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
+                U_new(i,j,k,0) = N_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
+                U_new(i,j,k,1) = NUx_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
+                U_new(i,j,k,2) = NUy_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
+                U_new(i,j,k,3) = NUz_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
 #endif
             }
         );
     }
+
+    // Copy the updated values back, over the valid points
+    amrex::MultiFab::Copy(*fields.get(name_mf_N, lev), U_new_mf, 0, 0, 1, 0);
+    amrex::MultiFab::Copy(*fields.get(name_mf_NU, Direction{0}, lev), U_new_mf, 1, 0, 1, 0);
+    amrex::MultiFab::Copy(*fields.get(name_mf_NU, Direction{1}, lev), U_new_mf, 2, 0, 1, 0);
+    amrex::MultiFab::Copy(*fields.get(name_mf_NU, Direction{2}, lev), U_new_mf, 3, 0, 1, 0);
 }
 
 
@@ -1282,9 +1286,15 @@ void WarpXFluidContainer::DepositCurrent(
     WARPX_PROFILE("WarpXFluidContainer::DepositCurrent");
 
     // Temporary nodal currents
-    amrex::MultiFab tmp_jx_fluid(fields.get(name_mf_N, lev)->boxArray(), fields.get(name_mf_N, lev)->DistributionMap(), 1, 0);
-    amrex::MultiFab tmp_jy_fluid(fields.get(name_mf_N, lev)->boxArray(), fields.get(name_mf_N, lev)->DistributionMap(), 1, 0);
-    amrex::MultiFab tmp_jz_fluid(fields.get(name_mf_N, lev)->boxArray(), fields.get(name_mf_N, lev)->DistributionMap(), 1, 0);
+    amrex::BoxArray const& ba_N = fields.get(name_mf_N, lev)->boxArray();
+    amrex::DistributionMapping const& dm_N = fields.get(name_mf_N, lev)->DistributionMap();
+    ScratchMultiFabPool& scratch_pool = WarpX::GetInstance().GetScratchPool();
+    ScratchMultiFab tmp_jx_scratch = scratch_pool.Get(ba_N, dm_N, 1, amrex::IntVect(0), "tmp_jx_fluid");
+    ScratchMultiFab tmp_jy_scratch = scratch_pool.Get(ba_N, dm_N, 1, amrex::IntVect(0), "tmp_jy_fluid");
+    ScratchMultiFab tmp_jz_scratch = scratch_pool.Get(ba_N, dm_N, 1, amrex::IntVect(0), "tmp_jz_fluid");
+    amrex::MultiFab& tmp_jx_fluid = *tmp_jx_scratch;
+    amrex::MultiFab& tmp_jy_fluid = *tmp_jy_scratch;
+    amrex::MultiFab& tmp_jz_fluid = *tmp_jz_scratch;
 
     const amrex::Real inv_clight_sq = 1.0_prt / PhysConst::c / PhysConst::c;
     const amrex::Real q = getCharge();
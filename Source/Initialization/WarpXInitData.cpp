@@ -78,7 +78,11 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -738,7 +742,9 @@ WarpX::InitPML ()
             do_pml_Hi[0][idim] = 1; // on level 0
         }
     }
-    if (max_level > 0) { do_pml = 1; }
+    // The hybrid-PIC solver does not use PML around the fine patches, since
+    // their boundary values are interpolated from the coarser levels
+    if (max_level > 0 && electromagnetic_solver_id != ElectromagneticSolverAlgo::HybridPIC) { do_pml = 1; }
     if (do_pml)
     {
         bool const eb_enabled = EB::enabled();
@@ -1611,27 +1617,94 @@ WarpX::ReadExternalFieldFromFile (
 
     auto FC = F[F_component];
     const auto extent = FC.getExtent();
-    const auto extent0 = static_cast<int>(extent[0]);
-    const auto extent1 = static_cast<int>(extent[1]);
-    const auto extent2 = static_cast<int>(extent[2]);
 
-    // Determine the chunk data that will be loaded.
-    // Now, the full range of data is loaded.
-    // Loading chunk data can speed up the process.
-    // Thus, `chunk_offset` and `chunk_extent` should be modified accordingly in another PR.
-    const openPMD::Offset chunk_offset = {0,0,0};
-    const openPMD::Extent chunk_extent = {extent[0], extent[1], extent[2]};
+    // Determine the chunk data that will be loaded:
+    // only the range of the file grid that is needed to interpolate
+    // onto the boxes of this MPI rank (including the guard cells).
+    // The file axes are {x, y, z} in 3D and {mode, r, z} in RZ.
+#if defined(WARPX_DIM_RZ)
+    const std::array<amrex::Real,AMREX_SPACEDIM> file_offset = {offset0, offset1};
+    const std::array<amrex::Real,AMREX_SPACEDIM> file_d = {file_dr, file_dz};
+    constexpr int first_file_axis = 1;
+#elif defined(WARPX_DIM_3D)
+    const std::array<amrex::Real,AMREX_SPACEDIM> file_offset = {offset0, offset1, offset2};
+    const std::array<amrex::Real,AMREX_SPACEDIM> file_d = {file_dx, file_dy, file_dz};
+    constexpr int first_file_axis = 0;
+#endif
+    std::array<long,3> chunk_lo = {0, 0, 0};
+    std::array<long,3> chunk_hi = {0, 0, 0};
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        chunk_lo[first_file_axis + dir] = std::numeric_limits<long>::max();
+        chunk_hi[first_file_axis + dir] = std::numeric_limits<long>::lowest();
+    }
+    bool has_boxes = false;
+    for (MFIter mfi(*mf, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        has_boxes = true;
+        const amrex::Box tb = mfi.tilebox(nodal_flag, mf->nGrowVect());
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            int ilo = tb.smallEnd(dir);
+            int ihi = tb.bigEnd(dir);
+#if defined(WARPX_DIM_RZ)
+            // negative r indices use the mirrored values (see below)
+            if (dir == 0) {
+                const int abs_lo = std::abs(ilo);
+                const int abs_hi = std::abs(ihi);
+                ilo = (ilo <= 0 && ihi >= 0) ? 0 : std::min(abs_lo, abs_hi);
+                ihi = std::max(abs_lo, abs_hi);
+            }
+#endif
+            const amrex::Real shift =
+                (tb.type(dir) == amrex::IndexType::CellIndex::NODE) ? 0._rt : 0.5_rt*dx[dir];
+            const amrex::Real xlo = static_cast<amrex::Real>(real_box.lo(dir)) + ilo*dx[dir] + shift;
+            const amrex::Real xhi = static_cast<amrex::Real>(real_box.lo(dir)) + ihi*dx[dir] + shift;
+            const int axis = first_file_axis + dir;
+            // the interpolation uses the file grid points i and i+1
+            chunk_lo[axis] = std::min(chunk_lo[axis],
+                static_cast<long>(std::floor((xlo - file_offset[dir])/file_d[dir])));
+            chunk_hi[axis] = std::max(chunk_hi[axis],
+                static_cast<long>(std::floor((xhi - file_offset[dir])/file_d[dir])) + 1);
+        }
+    }
+
+    // Nothing to read if this MPI rank has no box
+    if (!has_boxes) { return; }
+
+    openPMD::Offset chunk_offset = {0, 0, 0};
+    openPMD::Extent chunk_extent = {extent[0], extent[1], extent[2]};
+    for (int axis = first_file_axis; axis < 3; ++axis) {
+        const auto file_hi = static_cast<long>(extent[axis]) - 1;
+        long lo = std::clamp(chunk_lo[axis], 0L, file_hi);
+        long hi = std::clamp(chunk_hi[axis], lo, file_hi);
+        // The interpolation needs the points i and i+1 of the chunk: keep at least two points,
+        // also when the boxes of this MPI rank are outside of the file grid
+        if (hi == lo) {
+            if (hi == file_hi) { lo = std::max(hi - 1, 0L); }
+            else { hi = lo + 1; }
+        }
+        chunk_offset[axis] = static_cast<std::uint64_t>(lo);
+        chunk_extent[axis] = static_cast<std::uint64_t>(hi - lo + 1);
+    }
 
     auto FC_chunk_data = FC.loadChunk<double>(chunk_offset,chunk_extent);
     series.flush();
     auto *FC_data_host = FC_chunk_data.get();
 
     // Load data to GPU
-    const size_t total_extent = size_t(extent[0]) * extent[1] * extent[2];
+    const size_t total_extent = size_t(chunk_extent[0]) * chunk_extent[1] * chunk_extent[2];
     amrex::Gpu::DeviceVector<double> FC_data_gpu(total_extent);
     auto *FC_data = FC_data_gpu.data();
     amrex::Gpu::copy(amrex::Gpu::hostToDevice, FC_data_host, FC_data_host + total_extent, FC_data);
 
+    // Offset and size of the chunk along each axis, used to index the chunk data
+    const auto chunk_offset0 = static_cast<int>(chunk_offset[0]);
+    const auto chunk_offset1 = static_cast<int>(chunk_offset[1]);
+    const auto chunk_offset2 = static_cast<int>(chunk_offset[2]);
+    const auto chunk_extent0 = static_cast<int>(chunk_extent[0]);
+    const auto chunk_extent1 = static_cast<int>(chunk_extent[1]);
+    const auto chunk_extent2 = static_cast<int>(chunk_extent[2]);
+    amrex::ignore_unused(chunk_offset0);
+
     // Loop over boxes
     for (MFIter mfi(*mf, TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
@@ -1667,13 +1740,16 @@ WarpX::ReadExternalFieldFromFile (
                 else { x1 = real_box.lo(1) + j*dx[1] + 0.5_rt*dx[1]; }
 
 #if defined(WARPX_DIM_RZ)
-                // Get index of the external field array
-                int const ir = std::floor( (x0-offset0)/file_dr );
-                int const iz = std::floor( (x1-offset1)/file_dz );
+                // Get index of the external field array, relative to the loaded chunk
+                // (clamped to the chunk, for the points outside of the file grid)
+                int const ir = amrex::max(0, amrex::min(
+                    static_cast<int>(std::floor( (x0-offset0)/file_dr )) - chunk_offset1, chunk_extent1 - 2));
+                int const iz = amrex::max(0, amrex::min(
+                    static_cast<int>(std::floor( (x1-offset1)/file_dz )) - chunk_offset2, chunk_extent2 - 2));
 
                 // Get coordinates of external grid point
-                amrex::Real const xx0 = offset0 + ir * file_dr;
-                amrex::Real const xx1 = offset1 + iz * file_dz;
+                amrex::Real const xx0 = offset0 + (ir + chunk_offset1) * file_dr;
+                amrex::Real const xx1 = offset1 + (iz + chunk_offset2) * file_dz;
 
 #elif defined(WARPX_DIM_3D)
                 amrex::Real x2;
@@ -1681,19 +1757,23 @@ WarpX::ReadExternalFieldFromFile (
                      { x2 = real_box.lo(2) + k*dx[2]; }
                 else { x2 = real_box.lo(2) + k*dx[2] + 0.5_rt*dx[2]; }
 
-                // Get index of the external field array
-                int const ix = std::floor( (x0-offset0)/file_dx );
-                int const iy = std::floor( (x1-offset1)/file_dy );
-                int const iz = std::floor( (x2-offset2)/file_dz );
+                // Get index of the external field array, relative to the loaded chunk
+                // (clamped to the chunk, for the points outside of the file grid)
+                int const ix = amrex::max(0, amrex::min(
+                    static_cast<int>(std::floor( (x0-offset0)/file_dx )) - chunk_offset0, chunk_extent0 - 2));
+                int const iy = amrex::max(0, amrex::min(
+                    static_cast<int>(std::floor( (x1-offset1)/file_dy )) - chunk_offset1, chunk_extent1 - 2));
+                int const iz = amrex::max(0, amrex::min(
+                    static_cast<int>(std::floor( (x2-offset2)/file_dz )) - chunk_offset2, chunk_extent2 - 2));
 
                 // Get coordinates of external grid point
-                amrex::Real const xx0 = offset0 + ix * file_dx;
-                amrex::Real const xx1 = offset1 + iy * file_dy;
-                amrex::Real const xx2 = offset2 + iz * file_dz;
+                amrex::Real const xx0 = offset0 + (ix + chunk_offset0) * file_dx;
+                amrex::Real const xx1 = offset1 + (iy + chunk_offset1) * file_dy;
+                amrex::Real const xx2 = offset2 + (iz + chunk_offset2) * file_dz;
 #endif
 
 #if defined(WARPX_DIM_RZ)
-                const amrex::Array4<double> fc_array(FC_data, {0,0,0}, {extent0, extent2, extent1}, 1);
+                const amrex::Array4<double> fc_array(FC_data, {0,0,0}, {chunk_extent0, chunk_extent2, chunk_extent1}, 1);
                 const double
                     f00 = fc_array(0, iz  , ir  ),
                     f01 = fc_array(0, iz  , ir+1),
@@ -1704,7 +1784,7 @@ WarpX::ReadExternalFieldFromFile (
                      f00, f01, f10, f11,
                      x0, x1));
 #elif defined(WARPX_DIM_3D)
-                const amrex::Array4<double> fc_array(FC_data, {0,0,0}, {extent2, extent1, extent0}, 1);
+                const amrex::Array4<double> fc_array(FC_data, {0,0,0}, {chunk_extent2, chunk_extent1, chunk_extent0}, 1);
                 const double
                     f000 = fc_array(iz  , iy  , ix  ),
                     f001 = fc_array(iz+1, iy  , ix  ),
@@ -84,42 +84,29 @@ WarpXLaserProfiles::GaussianLaserProfile::init (
 
 }
 
-/* \brief compute field amplitude for a Gaussian laser, at particles' position
- *
- * Both Xp and Yp are given in laser plane coordinate.
- * For each particle with position Xp and Yp, this routine computes the
- * amplitude of the laser electric field, stored in array amplitude.
- *
- * \param np: number of laser particles
- * \param Xp: pointer to first component of positions of laser particles
- * \param Yp: pointer to second component of positions of laser particles
- * \param t: Current physical time
- * \param amplitude: pointer to array of field amplitude.
- */
-void
-WarpXLaserProfiles::GaussianLaserProfile::fill_amplitude (
-    const int np, Real const * AMREX_RESTRICT const Xp, Real const * AMREX_RESTRICT const Yp,
-    Real t, Real * AMREX_RESTRICT const amplitude) const
+WarpXLaserProfiles::GaussianLaserProfile::UniformFactors
+WarpXLaserProfiles::GaussianLaserProfile::compute_uniform_factors (Real t) const
 {
     const Complex I(0,1);
+    UniformFactors f;
     // Calculate a few factors which are independent of the macroparticle
-    const Real k0 = 2._rt*MathConst::pi/m_common_params.wavelength;
-    const Real inv_tau2 = 1._rt /(m_params.duration * m_params.duration);
-    const Real oscillation_phase = k0 * PhysConst::c * ( t - m_params.t_peak ) + m_params.phi0;
+    f.k0 = 2._rt*MathConst::pi/m_common_params.wavelength;
+    f.inv_tau2 = 1._rt /(m_params.duration * m_params.duration);
+    const Real oscillation_phase = f.k0 * PhysConst::c * ( t - m_params.t_peak ) + m_params.phi0;
     // The coefficients below contain info about Gouy phase,
     // laser diffraction, and phase front curvature
     const Complex diffract_factor =
         1._rt + I * m_params.focal_distance * 2._rt/
-        ( k0 * m_params.waist * m_params.waist );
-    const Complex inv_complex_waist_2 =
+        ( f.k0 * m_params.waist * m_params.waist );
+    f.inv_complex_waist_2 =
         1._rt /(m_params.waist*m_params.waist * diffract_factor );
 
     // Time stretching due to STCs and phi2 complex envelope
     // (1 if zeta=0, beta=0, phi2=0)
-    const Complex stretch_factor = 1._rt + 4._rt *
-        ((m_params.zeta+m_params.beta*m_params.focal_distance)*inv_tau2)
-        * ((m_params.zeta+m_params.beta*m_params.focal_distance)*inv_complex_waist_2)
-        + 2._rt*I*(m_params.phi2-m_params.beta*m_params.beta*k0*m_params.focal_distance)*inv_tau2;
+    f.stretch_factor = 1._rt + 4._rt *
+        ((m_params.zeta+m_params.beta*m_params.focal_distance)*f.inv_tau2)
+        * ((m_params.zeta+m_params.beta*m_params.focal_distance)*f.inv_complex_waist_2)
+        + 2._rt*I*(m_params.phi2-m_params.beta*m_params.beta*f.k0*m_params.focal_distance)*f.inv_tau2;
 
     // Amplitude and monochromatic oscillations
     const Complex t_prefactor =
@@ -129,12 +116,39 @@ WarpXLaserProfiles::GaussianLaserProfile::fill_amplitude (
     // account the impact of the dimensionality on both the Gouy phase
     // and the amplitude of the laser
 #if (defined(WARPX_DIM_3D) || (defined WARPX_DIM_RZ))
-    const Complex prefactor = t_prefactor / diffract_factor;
+    f.prefactor = t_prefactor / diffract_factor;
 #elif defined(WARPX_DIM_XZ)
-    const Complex prefactor = t_prefactor / amrex::sqrt(diffract_factor);
+    f.prefactor = t_prefactor / amrex::sqrt(diffract_factor);
 #else
-    const Complex prefactor = t_prefactor;
+    f.prefactor = t_prefactor;
 #endif
+    return f;
+}
+
+/* \brief compute field amplitude for a Gaussian laser, at particles' position
+ *
+ * Both Xp and Yp are given in laser plane coordinate.
+ * For each particle with position Xp and Yp, this routine computes the
+ * amplitude of the laser electric field, stored in array amplitude.
+ *
+ * \param np: number of laser particles
+ * \param Xp: pointer to first component of positions of laser particles
+ * \param Yp: pointer to second component of positions of laser particles
+ * \param t: Current physical time
+ * \param amplitude: pointer to array of field amplitude.
+ */
+void
+WarpXLaserProfiles::GaussianLaserProfile::fill_amplitude (
+    const int np, Real const * AMREX_RESTRICT const Xp, Real const * AMREX_RESTRICT const Yp,
+    Real t, Real * AMREX_RESTRICT const amplitude) const
+{
+    const Complex I(0,1);
+    const UniformFactors f = compute_uniform_factors(t);
+    const Real k0 = f.k0;
+    const Real inv_tau2 = f.inv_tau2;
+    const Complex inv_complex_waist_2 = f.inv_complex_waist_2;
+    const Complex stretch_factor = f.stretch_factor;
+    const Complex prefactor = f.prefactor;
 
     // Copy member variables to tmp copies for GPU runs.
     auto const tmp_profile_t_peak = m_params.t_peak;
@@ -160,3 +174,80 @@ WarpXLaserProfiles::GaussianLaserProfile::fill_amplitude (
         }
         );
 }
+
+void
+WarpXLaserProfiles::GaussianLaserProfile::fill_transverse_factor (
+    const int np, Real const * AMREX_RESTRICT const Xp, Real const * AMREX_RESTRICT const Yp,
+    TransverseFactorOut const& factor) const
+{
+    // The transverse envelope does not depend on time
+    const Complex inv_complex_waist_2 = compute_uniform_factors(m_params.t_peak).inv_complex_waist_2;
+    auto const tmp_theta_stc = m_params.theta_stc;
+    Real * AMREX_RESTRICT const envelope_re = factor[0];
+    Real * AMREX_RESTRICT const envelope_im = factor[1];
+    Real * AMREX_RESTRICT const stc_coord = factor[2];
+    amrex::ParallelFor(
+        np,
+        [=] AMREX_GPU_DEVICE (int i) {
+            // Complex transverse envelope
+            const Complex envelope = amrex::exp( - ( Xp[i]*Xp[i] + Yp[i]*Yp[i] ) * inv_complex_waist_2 );
+            envelope_re[i] = envelope.real();
+            envelope_im[i] = envelope.imag();
+            // Coordinate along the direction of the spatio-temporal couplings
+            stc_coord[i] = Xp[i]*std::cos(tmp_theta_stc) + Yp[i]*std::sin(tmp_theta_stc);
+        }
+        );
+}
+
+void
+WarpXLaserProfiles::GaussianLaserProfile::fill_amplitude_from_transverse_factor (
+    const int np, TransverseFactor const& factor,
+    Real t, Real * AMREX_RESTRICT const amplitude) const
+{
+    const Complex I(0,1);
+    const UniformFactors f = compute_uniform_factors(t);
+    const Real k0 = f.k0;
+    const Real inv_tau2 = f.inv_tau2;
+    const Complex inv_complex_waist_2 = f.inv_complex_waist_2;
+    const Complex stretch_factor = f.stretch_factor;
+    const Complex prefactor = f.prefactor;
+
+    ParticleReal const * AMREX_RESTRICT const envelope_re = factor[0];
+    ParticleReal const * AMREX_RESTRICT const envelope_im = factor[1];
+    ParticleReal const * AMREX_RESTRICT const stc_coord = factor[2];
+
+    auto const tmp_profile_t_peak = m_params.t_peak;
+    auto const tmp_beta = m_params.beta;
+    auto const tmp_zeta = m_params.zeta;
+    auto const tmp_profile_focal_distance = m_params.focal_distance;
+
+    if (tmp_beta == 0._rt && tmp_zeta == 0._rt) {
+        // Without spatio-temporal couplings, the time envelope is the same for all
+        // the particles, and only multiplies the transverse envelope
+        const Complex stc_exponent = 1._rt / stretch_factor * inv_tau2 *
+            (t - tmp_profile_t_peak)*(t - tmp_profile_t_peak);
+        const Complex stcfactor = prefactor * amrex::exp( - stc_exponent );
+        amrex::ParallelFor(
+            np,
+            [=] AMREX_GPU_DEVICE (int i) {
+                const Complex envelope(envelope_re[i], envelope_im[i]);
+                amplitude[i] = ( stcfactor * envelope ).real();
+            }
+            );
+    } else {
+        amrex::ParallelFor(
+            np,
+            [=] AMREX_GPU_DEVICE (int i) {
+                const Complex stc_exponent = 1._rt / stretch_factor * inv_tau2 *
+                    amrex::pow((t - tmp_profile_t_peak -
+                        tmp_beta*k0*stc_coord[i] -
+                        2._rt *I*stc_coord[i]
+                        *( tmp_zeta - tmp_beta*tmp_profile_focal_distance ) * inv_complex_waist_2),2);
+                // stcfactor = everything but complex transverse envelope
+                const Complex stcfactor = prefactor * amrex::exp( - stc_exponent );
+                const Complex envelope(envelope_re[i], envelope_im[i]);
+                amplitude[i] = ( stcfactor * envelope ).real();
+            }
+            );
+    }
+}
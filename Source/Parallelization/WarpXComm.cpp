@@ -14,6 +14,7 @@
 #endif
 #include "Fields.H"
 #include "Filter/BilinearFilter.H"
+#include "Utils/ScratchMultiFabPool.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXAlgorithmSelection.H"
 #include "Utils/WarpXProfilerWrapper.H"
@@ -44,9 +45,11 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_REAL.H>
 #include <AMReX_Vector.H>
+#include <AMReX_iMultiFab.H>
 
 #include <algorithm>
 #include <array>
+#include <iterator>
 #include <memory>
 #include <vector>
 
@@ -1090,6 +1093,124 @@ WarpX::FillBoundaryAux (int lev, IntVect ng)
     ablastr::utils::communication::FillBoundary(*Bfield_aux[lev][2], ng, WarpX::do_single_precision_comms, period);
 }
 
+void
+WarpX::InterpolateFromCoarseLevel (amrex::MultiFab& mf_fine, const amrex::MultiFab& mf_coarse,
+                                   const int lev, const int n_interior)
+{
+    WARPX_PROFILE("WarpX::InterpolateFromCoarseLevel()");
+
+    AMREX_ALWAYS_ASSERT(lev > 0 && mf_fine.ixType() == mf_coarse.ixType());
+
+    const amrex::IntVect& refinement_ratio = refRatio(lev-1);
+    const amrex::IntVect stag = mf_fine.ixType().toIntVect();
+    const amrex::IntVect ng = mf_fine.nGrowVect();
+    const int ncomp = mf_fine.nComp();
+
+    // Mask of the points of the fine boxes, including guard cells, that are
+    // outside of the fine patch: 1 in the guard cells that are not covered
+    // by another fine box and inside of the domain, 0 elsewhere.
+    // The masks only depend on the grids of the level, and are thus kept
+    // until the level is remade.
+    const amrex::IntVect ng_mask = ng + n_interior;
+    auto& masks = m_coarse_fine_masks[lev];
+    auto it_mask = std::find_if(masks.begin(), masks.end(),
+        [&] (const std::unique_ptr<amrex::iMultiFab>& m) {
+            return m->boxArray() == mf_fine.boxArray() &&
+                   m->DistributionMap() == mf_fine.DistributionMap() &&
+                   m->nGrowVect() == ng_mask;
+        });
+    if (it_mask == masks.end()) {
+        auto new_mask = std::make_unique<amrex::iMultiFab>(
+            mf_fine.boxArray(), mf_fine.DistributionMap(), 1, ng_mask);
+        const int covered = 0;
+        const int notcovered = 1;
+        const int physbnd = 0;
+        const int interior = 0;
+        new_mask->BuildMask(Geom(lev).Domain(), Geom(lev).periodicity(), covered, notcovered, physbnd, interior);
+        masks.push_back(std::move(new_mask));
+        it_mask = std::prev(masks.end());
+    }
+    const amrex::iMultiFab& mask = **it_mask;
+
+    // Copy the coarse data on the coarsened fine boxes, with enough guard
+    // cells for the interpolation to the guard cells of the fine boxes
+    amrex::BoxArray cba = mf_fine.boxArray();
+    cba.coarsen(refinement_ratio);
+    const amrex::IntVect ng_crse = (ng + refinement_ratio - 1) / refinement_ratio + 1;
+    ScratchMultiFab mf_crse_scratch = m_scratch_pool.Get(
+        cba, mf_fine.DistributionMap(), ncomp, ng_crse, "InterpolateFromCoarseLevel");
+    amrex::MultiFab& mf_crse = *mf_crse_scratch;
+    mf_crse.setVal(0.0);
+    ablastr::utils::communication::ParallelCopy(mf_crse, mf_coarse, 0, 0, ncomp,
+                                                amrex::IntVect(0), ng_crse, WarpX::do_single_precision_comms,
+                                                Geom(lev-1).periodicity());
+
+    const amrex::Dim3 ni3 = amrex::IntVect(n_interior).dim3();
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(mf_fine, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        // Only the points within n_interior cells of the edges of the box can be replaced
+        const Box interior_box = amrex::grow(mfi.validbox(), -n_interior);
+        const Box bx = mfi.growntilebox();
+
+        Array4<Real> const& arr_fine = mf_fine.array(mfi);
+        Array4<Real> const& arr_crse = mf_crse.array(mfi);
+        Array4<int const> const& msk = mask.const_array(mfi);
+
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+            if (interior_box.contains(i,j,k)) { return; }
+
+            bool outside_patch = false;
+            for         (int kk = k-ni3.z; kk <= k+ni3.z && !outside_patch; ++kk) {
+                for     (int jj = j-ni3.y; jj <= j+ni3.y && !outside_patch; ++jj) {
+                    for (int ii = i-ni3.x; ii <= i+ni3.x && !outside_patch; ++ii) {
+                        outside_patch = (msk(ii,jj,kk) == 1);
+                    }
+                }
+            }
+            if (!outside_patch) { return; }
+
+            for (int n = 0; n < ncomp; ++n) {
+                // warpx_interp adds the interpolated coarse data to the fine data,
+                // which is thus set to zero first
+                Array4<Real> const arr_fine_n(arr_fine, n);
+                arr_fine_n(i,j,k) = 0.0_rt;
+                warpx_interp(i, j, k, arr_fine_n, Array4<Real const>(arr_fine, n),
+                             Array4<Real const>(arr_crse, n), stag, refinement_ratio);
+            }
+        });
+    }
+}
+
+void
+WarpX::AverageDownFromFineLevel (amrex::MultiFab& mf_coarse, const amrex::MultiFab& mf_fine, const int lev)
+{
+    WARPX_PROFILE("WarpX::AverageDownFromFineLevel()");
+
+    AMREX_ALWAYS_ASSERT(lev > 0 && mf_fine.ixType() == mf_coarse.ixType());
+
+    const amrex::IntVect& refinement_ratio = refRatio(lev-1);
+
+    // Average the fine data on the coarsened fine boxes, which have the same
+    // distribution mapping, and copy the result to the coarse level
+    amrex::BoxArray cba = mf_fine.boxArray();
+    cba.coarsen(refinement_ratio);
+    const amrex::IntVect ng_crse = (mf_fine.nGrowVect() + refinement_ratio - 1) / refinement_ratio;
+    ScratchMultiFab mf_crse_scratch = m_scratch_pool.Get(
+        cba, mf_fine.DistributionMap(), mf_fine.nComp(), ng_crse, "AverageDownFromFineLevel");
+    amrex::MultiFab& mf_crse = *mf_crse_scratch;
+    ablastr::coarsen::average::Coarsen(mf_crse, mf_fine, refinement_ratio);
+
+    ablastr::utils::communication::ParallelCopy(mf_coarse, mf_crse, 0, 0, mf_fine.nComp(),
+                                                amrex::IntVect(0), amrex::IntVect(0),
+                                                WarpX::do_single_precision_comms,
+                                                Geom(lev-1).periodicity());
+}
+
 void
 WarpX::SyncCurrent (const std::string& current_fp_string)
 {
@@ -1394,7 +1515,9 @@ void WarpX::ApplyFilterMF (
 
     const int ncomp = mf.nComp();
     const amrex::IntVect ngrow = mf.nGrowVect();
-    amrex::MultiFab mf_filtered(mf.boxArray(), mf.DistributionMap(), ncomp, ngrow);
+    ScratchMultiFab mf_filtered_scratch = m_scratch_pool.Get(
+        mf.boxArray(), mf.DistributionMap(), ncomp, ngrow, "ApplyFilterMF");
+    amrex::MultiFab& mf_filtered = *mf_filtered_scratch;
     bilinear_filter.ApplyStencil(mf_filtered, mf, lev);
 
     const int srccomp = 0;
@@ -1588,7 +1711,9 @@ void WarpX::ApplyFilterandSumBoundaryRho (int /*lev*/, int glev, amrex::MultiFab
         ng += bilinear_filter.stencil_length_each_dir-1;
         ng_depos_rho += bilinear_filter.stencil_length_each_dir-1;
         ng_depos_rho.min(ng);
-        MultiFab rf(rho.boxArray(), rho.DistributionMap(), ncomp, ng);
+        ScratchMultiFab rf_scratch = m_scratch_pool.Get(
+            rho.boxArray(), rho.DistributionMap(), ncomp, ng, "ApplyFilterandSumBoundaryRho");
+        MultiFab& rf = *rf_scratch;
         bilinear_filter.ApplyStencil(rf, rho, glev, icomp, 0, ncomp);
         WarpXSumGuardCells(rho, rf, period, ng_depos_rho, icomp, ncomp );
     } else {
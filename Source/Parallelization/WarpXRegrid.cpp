@@ -182,6 +182,11 @@ WarpX::RemakeLevel (int lev, Real /*time*/, const BoxArray& ba, const Distributi
         mf = std::move(pmf);
     };
 
+    // The cached temporaries and masks are defined on the old grids
+    m_scratch_pool.Clear();
+    m_coarse_fine_masks[lev].clear();
+    ++m_field_data_generation;
+
     bool const eb_enabled = EB::enabled();
     if (ba == boxArray(lev))
     {
@@ -213,6 +218,9 @@ WarpX::RemakeLevel (int lev, Real /*time*/, const BoxArray& ba, const Distributi
                                                            amrex::EBSupport::full);
 #endif
             InitializeEBGridData(lev);
+            // The distance function was redistributed with the other fields,
+            // but the box classification is indexed by the old boxes
+            ClassifyBoxesByDistanceToEB(lev);
         } else {
             m_field_factory[lev] = std::make_unique<FArrayBoxFactory>();
         }
@@ -15,10 +15,18 @@
 #include "Utils/WarpXProfilerWrapper.H"
 #include "WarpX.H"
 
+#include <AMReX_Box.H>
+#include <AMReX_GpuContainers.H>
+#include <AMReX_GpuMemory.H>
+#include <AMReX_GpuReduce.H>
 #include <AMReX_ParmParse.H>
+#include <AMReX_Random.H>
 #include <AMReX_REAL.H>
 #include <AMReX_Vector.H>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <string>
 
 BackgroundMCCCollision::BackgroundMCCCollision (std::string const& collision_name)
@@ -77,6 +85,11 @@ BackgroundMCCCollision::BackgroundMCCCollision (std::string const& collision_nam
         "The maximum background density must be greater than 0."
     );
 
+    // with a spatially varying background density, the maximum collision
+    // frequency can be computed in each tile rather than from the global
+    // maximum density, which reduces the number of null collisions
+    pp_collision_name.query("per_tile_nu_max", m_per_tile_nu_max);
+
     // if the neutral mass is specified use it, but if ionization is
     // included the mass of the secondary species of that interaction
     // will be used. If no neutral mass is specified and ionization is not
@@ -292,6 +305,11 @@ BackgroundMCCCollision::doCollisions (amrex::Real cur_time, amrex::Real dt, Mult
 
         auto *cost = WarpX::getCosts(lev);
 
+        // whether the background density exceeded the estimate of its maximum in a tile,
+        // set on the device and only read once all the tiles are done
+        amrex::Gpu::DeviceScalar<int> density_bound_exceeded(0);
+        int* const density_bound_exceeded_ptr = density_bound_exceeded.dataPtr();
+
         // firstly loop over particles box by box and do all particle conserving
         // scattering
 #ifdef _OPENMP
@@ -304,7 +322,7 @@ BackgroundMCCCollision::doCollisions (amrex::Real cur_time, amrex::Real dt, Mult
             }
             auto wt = static_cast<amrex::Real>(amrex::second());
 
-            doBackgroundCollisionsWithinTile(pti, cur_time);
+            doBackgroundCollisionsWithinTile(pti, cur_time, density_bound_exceeded_ptr);
 
             if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
             {
@@ -314,6 +332,13 @@ BackgroundMCCCollision::doCollisions (amrex::Real cur_time, amrex::Real dt, Mult
             }
         }
 
+        if (m_per_tile_nu_max && density_bound_exceeded.dataValue() != 0) {
+            ablastr::warn_manager::WMRecordWarning("BackgroundMCC Collisions",
+                "The background density at some particles of " + m_species_names[0] +
+                " exceeds its maximum at the nodes of their tile, so that collisions were missed. " +
+                "Resolve the background density better or turn off per_tile_nu_max.");
+        }
+
         // secondly perform ionization through the SmartCopyFactory if needed
         if (ionization_flag) {
             doBackgroundIonization(lev, cost, species1, species2, cur_time);
@@ -323,15 +348,16 @@ BackgroundMCCCollision::doCollisions (amrex::Real cur_time, amrex::Real dt, Mult
 
 
 void BackgroundMCCCollision::doBackgroundCollisionsWithinTile
-( WarpXParIter& pti, amrex::Real t )
+( WarpXParIter& pti, amrex::Real t, int* bound_exceeded_ptr )
 {
     using namespace amrex::literals;
 
     // So that CUDA code gets its intrinsic, not the host-only C++ library version
-    using std::sqrt;
+    using std::sqrt, std::log, std::pow, std::floor;
 
     // get particle count
-    const long np = pti.numParticles();
+    const auto np = static_cast<int>(pti.numParticles());
+    if (np == 0) { return; }
 
     // get parsers for the background density and temperature
     auto n_a_func = m_background_density_func;
@@ -341,8 +367,30 @@ void BackgroundMCCCollision::doBackgroundCollisionsWithinTile
     auto *scattering_processes = m_scattering_processes_exe.data();
     auto const process_count  = static_cast<int>(m_scattering_processes_exe.size());
 
-    auto const total_collision_prob = m_total_collision_prob;
-    auto const nu_max = m_nu_max;
+    auto const total_collision_prob_global = m_total_collision_prob;
+    auto const nu_max_global = m_nu_max;
+    auto const max_background_density = m_max_background_density;
+    bool const per_tile_nu_max = m_per_tile_nu_max;
+
+    // With per_tile_nu_max, the maximum of the background density at the nodes of the
+    // tile is reduced on the device, where the collision kernel reads it, so that the
+    // host does not wait for it
+    amrex::ParticleReal* n_a_tile_max_ptr = nullptr;
+    if (per_tile_nu_max) {
+        n_a_tile_max_ptr = static_cast<amrex::ParticleReal*>(
+            amrex::The_Async_Arena()->alloc(sizeof(amrex::ParticleReal)));
+        getMaxBackgroundDensityInTile(pti, t, n_a_tile_max_ptr);
+    }
+
+    // Null-collision method: each particle is a candidate for a collision with the
+    // probability total_collision_prob, and the cross sections are only evaluated for
+    // the candidates. The particles are split in contiguous blocks, and the candidates
+    // of a block are found by drawing the gaps between them, which follow a geometric
+    // distribution: only about one random number is drawn per candidate. The blocks hold
+    // about one candidate each, so that the candidates are spread over the threads.
+    int const block_size = std::clamp(
+        static_cast<int>(1.0_prt/std::max(total_collision_prob_global, 1.e-6_prt)), 1, 1024);
+    int const n_blocks = (np + block_size - 1) / block_size;
 
     // store projectile and target masses
     auto const m = m_mass1;
@@ -362,115 +410,198 @@ void BackgroundMCCCollision::doBackgroundCollisionsWithinTile
     amrex::ParticleReal* const AMREX_RESTRICT uy = attribs[PIdx::uy].dataPtr();
     amrex::ParticleReal* const AMREX_RESTRICT uz = attribs[PIdx::uz].dataPtr();
 
-    amrex::ParallelForRNG(np,
-                          [=] AMREX_GPU_HOST_DEVICE (long ip, amrex::RandomEngine const& engine)
+    amrex::ParallelForRNG(n_blocks,
+                          [=] AMREX_GPU_HOST_DEVICE (int i_block, amrex::RandomEngine const& engine)
                           {
-                              // determine if this particle should collide
-                              if (amrex::Random(engine) > total_collision_prob) { return; }
-
-                              amrex::ParticleReal x, y, z;
-                              GetPosition.AsStored(ip, x, y, z);
-
-                              const amrex::ParticleReal n_a = n_a_func(x, y, z, t);
-                              const amrex::ParticleReal T_a = T_a_func(x, y, z, t);
-
-                              amrex::ParticleReal v_coll, v_coll2, sigma_E, nu_i = 0;
-                              double gamma, E_coll;
-                              amrex::ParticleReal ua_x, ua_y, ua_z, vx, vy, vz;
-                              amrex::ParticleReal uCOM_x, uCOM_y, uCOM_z;
-                              const amrex::ParticleReal col_select = amrex::Random(engine);
-
-                              // get velocities of gas particles from a Maxwellian distribution
-                              auto const vel_std = sqrt(PhysConst::kb * T_a / M);
-                              ua_x = vel_std * amrex::RandomNormal(0_prt, 1.0_prt, engine);
-                              ua_y = vel_std * amrex::RandomNormal(0_prt, 1.0_prt, engine);
-                              ua_z = vel_std * amrex::RandomNormal(0_prt, 1.0_prt, engine);
-
-                              // we assume the target particle is not relativistic (in
-                              // the lab frame) and therefore we can transform the projectile
-                              // velocity to a frame in which the target is stationary with
-                              // a simple Galilean boost
-                              // not doing the full Lorentz boost here saves us computation
-                              // since most particles will not actually collide
-                              vx = ux[ip] - ua_x;
-                              vy = uy[ip] - ua_y;
-                              vz = uz[ip] - ua_z;
-                              v_coll2 = (vx*vx + vy*vy + vz*vz);
-                              v_coll = std::sqrt(v_coll2);
-
-                              // calculate the collision energy in eV
-                              ParticleUtils::getCollisionEnergy(v_coll2, m, M, gamma, E_coll);
-
-                              // loop through all collision pathways
-                              for (int i = 0; i < process_count; i++) {
-                                  auto const& scattering_process = *(scattering_processes + i);
-
-                                  // get collision cross-section
-                                  sigma_E = scattering_process.getCrossSection(static_cast<amrex::ParticleReal>(E_coll));
-
-                                  // calculate normalized collision frequency
-                                  nu_i += n_a * sigma_E * v_coll / nu_max;
-
-                                  // check if this collision should be performed
-                                  if (col_select > nu_i) { continue; }
-
-                                  // charge exchange is implemented as a simple swap of the projectile
-                                  // and target velocities which doesn't require any of the Lorentz
-                                  // transformations below; note that if the projectile and target
-                                  // have the same mass this is identical to back scattering
-                                  if (scattering_process.m_type == ScatteringProcessType::CHARGE_EXCHANGE) {
-                                      ux[ip] = ua_x;
-                                      uy[ip] = ua_y;
-                                      uz[ip] = ua_z;
-                                      break;
-                                  }
-
-                                  // At this point the given particle has been chosen for a collision
-                                  // and so we perform the needed calculations to transform to the
-                                  // COM frame.
-                                  uCOM_x = static_cast<amrex::ParticleReal>(m * vx / (gamma * m + M));
-                                  uCOM_y = static_cast<amrex::ParticleReal>(m * vy / (gamma * m + M));
-                                  uCOM_z = static_cast<amrex::ParticleReal>(m * vz / (gamma * m + M));
-
-                                  // subtract any energy penalty of the collision from the
-                                  // projectile energy
-                                  if (scattering_process.m_energy_penalty > 0.0_prt) {
-                                      ParticleUtils::getEnergy(v_coll2, m, E_coll);
-                                      E_coll = (E_coll - scattering_process.m_energy_penalty) * PhysConst::q_e;
-                                      const auto scale_fac = static_cast<amrex::ParticleReal>(
-                                        std::sqrt(E_coll * (E_coll + 2.0_prt*mc2) / c2) / m / v_coll);
-                                      vx *= scale_fac;
-                                      vy *= scale_fac;
-                                      vz *= scale_fac;
+                              auto total_collision_prob = total_collision_prob_global;
+                              auto nu_max = nu_max_global;
+                              // background density above which nu_max is not a bound of the collision frequency
+                              auto n_a_bound = max_background_density;
+                              if (per_tile_nu_max) {
+                                  // nu_max is proportional to the background density. The maximum at the
+                                  // nodes of the tile is only an estimate of the maximum at the particles:
+                                  // the ratio is clamped to 1 so that nu_max never exceeds its global bound,
+                                  // and the tiles where the density is zero at all the nodes fall back to
+                                  // the global bound.
+                                  auto density_ratio = *n_a_tile_max_ptr / max_background_density;
+                                  if (density_ratio <= 0.0_prt) { density_ratio = 1.0_prt; }
+                                  density_ratio = amrex::min(density_ratio, 1.0_prt);
+                                  nu_max *= density_ratio;
+                                  n_a_bound *= density_ratio;
+                                  // 1 - exp(-nu_max*dt) with the rescaled nu_max
+                                  total_collision_prob = 1.0_prt - pow(1.0_prt - total_collision_prob_global, density_ratio);
+                              }
+                              if (total_collision_prob <= 0.0_prt) { return; }
+                              auto const log_no_collision = (total_collision_prob < 1.0_prt) ?
+                                  log(1.0_prt - total_collision_prob) : 0.0_prt;
+
+                              int const ip_end = amrex::min((i_block + 1) * block_size, np);
+                              int ip = i_block * block_size - 1;
+                              while (true) {
+                                  // number of particles skipped before the next candidate
+                                  if (log_no_collision < 0.0_prt) {
+                                      auto const r = static_cast<amrex::ParticleReal>(amrex::Random(engine));
+                                      if (r <= 0.0_prt) { break; }
+                                      auto const n_skipped = floor(log(r) / log_no_collision);
+                                      if (n_skipped >= static_cast<amrex::ParticleReal>(ip_end - ip - 1)) { break; }
+                                      ip += static_cast<int>(n_skipped);
                                   }
+                                  ++ip;
+                                  if (ip >= ip_end) { break; }
 
-                                  // transform to COM frame
-                                  ParticleUtils::doLorentzTransform(vx, vy, vz, uCOM_x, uCOM_y, uCOM_z);
+                                  // this particle was chosen as a candidate for a collision
+                                  amrex::ParticleReal x, y, z;
+                                  GetPosition.AsStored(ip, x, y, z);
 
-                                  if ((scattering_process.m_type == ScatteringProcessType::ELASTIC)
-                                      || (scattering_process.m_type == ScatteringProcessType::EXCITATION)) {
-                                      ParticleUtils::RandomizeVelocity(
-                                          vx, vy, vz, sqrt(vx*vx + vy*vy + vz*vz), engine
-                                      );
+                                  const amrex::ParticleReal n_a = n_a_func(x, y, z, t);
+                                  if (per_tile_nu_max && n_a > n_a_bound) {
+                                      amrex::Gpu::Atomic::Max(bound_exceeded_ptr, 1);
                                   }
-                                  else if (scattering_process.m_type == ScatteringProcessType::BACK) {
-                                      // elastic scattering with cos(chi) = -1 (i.e. 180 degrees)
-                                      vx *= -1.0_prt;
-                                      vy *= -1.0_prt;
-                                      vz *= -1.0_prt;
+                                  const amrex::ParticleReal T_a = T_a_func(x, y, z, t);
+
+                                  amrex::ParticleReal v_coll, v_coll2, sigma_E, nu_i = 0;
+                                  double gamma, E_coll;
+                                  amrex::ParticleReal ua_x, ua_y, ua_z, vx, vy, vz;
+                                  amrex::ParticleReal uCOM_x, uCOM_y, uCOM_z;
+                                  const amrex::ParticleReal col_select = amrex::Random(engine);
+
+                                  // get velocities of gas particles from a Maxwellian distribution
+                                  auto const vel_std = sqrt(PhysConst::kb * T_a / M);
+                                  ua_x = vel_std * amrex::RandomNormal(0_prt, 1.0_prt, engine);
+                                  ua_y = vel_std * amrex::RandomNormal(0_prt, 1.0_prt, engine);
+                                  ua_z = vel_std * amrex::RandomNormal(0_prt, 1.0_prt, engine);
+
+                                  // we assume the target particle is not relativistic (in
+                                  // the lab frame) and therefore we can transform the projectile
+                                  // velocity to a frame in which the target is stationary with
+                                  // a simple Galilean boost
+                                  // not doing the full Lorentz boost here saves us computation
+                                  // since most particles will not actually collide
+                                  vx = ux[ip] - ua_x;
+                                  vy = uy[ip] - ua_y;
+                                  vz = uz[ip] - ua_z;
+                                  v_coll2 = (vx*vx + vy*vy + vz*vz);
+                                  v_coll = std::sqrt(v_coll2);
+
+                                  // calculate the collision energy in eV
+                                  ParticleUtils::getCollisionEnergy(v_coll2, m, M, gamma, E_coll);
+
+                                  // loop through all collision pathways
+                                  for (int i = 0; i < process_count; i++) {
+                                      auto const& scattering_process = *(scattering_processes + i);
+
+                                      // get collision cross-section
+                                      sigma_E = scattering_process.getCrossSection(static_cast<amrex::ParticleReal>(E_coll));
+
+                                      // calculate normalized collision frequency
+                                      nu_i += n_a * sigma_E * v_coll / nu_max;
+
+                                      // check if this collision should be performed
+                                      if (col_select > nu_i) { continue; }
+
+                                      // charge exchange is implemented as a simple swap of the projectile
+                                      // and target velocities which doesn't require any of the Lorentz
+                                      // transformations below; note that if the projectile and target
+                                      // have the same mass this is identical to back scattering
+                                      if (scattering_process.m_type == ScatteringProcessType::CHARGE_EXCHANGE) {
+                                          ux[ip] = ua_x;
+                                          uy[ip] = ua_y;
+                                          uz[ip] = ua_z;
+                                          break;
+                                      }
+
+                                      // At this point the given particle has been chosen for a collision
+                                      // and so we perform the needed calculations to transform to the
+                                      // COM frame.
+                                      uCOM_x = static_cast<amrex::ParticleReal>(m * vx / (gamma * m + M));
+                                      uCOM_y = static_cast<amrex::ParticleReal>(m * vy / (gamma * m + M));
+                                      uCOM_z = static_cast<amrex::ParticleReal>(m * vz / (gamma * m + M));
+
+                                      // subtract any energy penalty of the collision from the
+                                      // projectile energy
+                                      if (scattering_process.m_energy_penalty > 0.0_prt) {
+                                          ParticleUtils::getEnergy(v_coll2, m, E_coll);
+                                          E_coll = (E_coll - scattering_process.m_energy_penalty) * PhysConst::q_e;
+                                          const auto scale_fac = static_cast<amrex::ParticleReal>(
+                                            std::sqrt(E_coll * (E_coll + 2.0_prt*mc2) / c2) / m / v_coll);
+                                          vx *= scale_fac;
+                                          vy *= scale_fac;
+                                          vz *= scale_fac;
+                                      }
+
+                                      // transform to COM frame
+                                      ParticleUtils::doLorentzTransform(vx, vy, vz, uCOM_x, uCOM_y, uCOM_z);
+
+                                      if ((scattering_process.m_type == ScatteringProcessType::ELASTIC)
+                                          || (scattering_process.m_type == ScatteringProcessType::EXCITATION)) {
+                                          ParticleUtils::RandomizeVelocity(
+                                              vx, vy, vz, sqrt(vx*vx + vy*vy + vz*vz), engine
+                                          );
+                                      }
+                                      else if (scattering_process.m_type == ScatteringProcessType::BACK) {
+                                          // elastic scattering with cos(chi) = -1 (i.e. 180 degrees)
+                                          vx *= -1.0_prt;
+                                          vy *= -1.0_prt;
+                                          vz *= -1.0_prt;
+                                      }
+
+                                      // transform back to scattering frame
+                                      ParticleUtils::doLorentzTransform(vx, vy, vz, -uCOM_x, -uCOM_y, -uCOM_z);
+
+                                      // update particle velocity with new components in labframe
+                                      ux[ip] = vx + ua_x;
+                                      uy[ip] = vy + ua_y;
+                                      uz[ip] = vz + ua_z;
+                                      break;
                                   }
-
-                                  // transform back to scattering frame
-                                  ParticleUtils::doLorentzTransform(vx, vy, vz, -uCOM_x, -uCOM_y, -uCOM_z);
-
-                                  // update particle velocity with new components in labframe
-                                  ux[ip] = vx + ua_x;
-                                  uy[ip] = vy + ua_y;
-                                  uz[ip] = vz + ua_z;
-                                  break;
                               }
                           }
                           );
+
+    if (n_a_tile_max_ptr) {
+        // stream-ordered: the memory is only released once the kernel is done
+        amrex::The_Async_Arena()->free(n_a_tile_max_ptr);
+    }
+}
+
+void
+BackgroundMCCCollision::getMaxBackgroundDensityInTile (WarpXParIter const& pti, amrex::Real t,
+                                                       amrex::ParticleReal* n_a_max_ptr) const
+{
+    auto n_a_func = m_background_density_func;
+
+    const amrex::Geometry& geom = WarpX::GetInstance().Geom(pti.GetLevel());
+    const auto plo = geom.ProbLoArray();
+    const auto dx = geom.CellSizeArray();
+
+    // the particles of this tile lie in the cells of the tile box,
+    // the density is thus sampled at the nodes of these cells
+    const amrex::Box box = amrex::convert(pti.tilebox(), amrex::IntVect::TheNodeVector());
+
+    amrex::single_task([=] AMREX_GPU_DEVICE () noexcept
+        {
+            *n_a_max_ptr = std::numeric_limits<amrex::ParticleReal>::lowest();
+        });
+    amrex::ParallelFor(amrex::Gpu::KernelInfo().setReduction(true), box,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, amrex::Gpu::Handler const& handler) noexcept
+        {
+#if defined(WARPX_DIM_3D)
+            const auto x = static_cast<amrex::ParticleReal>(plo[0] + i*dx[0]);
+            const auto y = static_cast<amrex::ParticleReal>(plo[1] + j*dx[1]);
+            const auto z = static_cast<amrex::ParticleReal>(plo[2] + k*dx[2]);
+#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
+            amrex::ignore_unused(k);
+            const auto x = static_cast<amrex::ParticleReal>(plo[0] + i*dx[0]);
+            const amrex::ParticleReal y = 0;
+            const auto z = static_cast<amrex::ParticleReal>(plo[1] + j*dx[1]);
+#else
+            amrex::ignore_unused(j, k);
+            const amrex::ParticleReal x = 0;
+            const amrex::ParticleReal y = 0;
+            const auto z = static_cast<amrex::ParticleReal>(plo[0] + i*dx[0]);
+#endif
+            amrex::Gpu::deviceReduceMax(n_a_max_ptr, n_a_func(x, y, z, t), handler);
+        });
 }
 
 
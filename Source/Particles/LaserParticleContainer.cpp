@@ -67,6 +67,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <utility>
 #include <vector>
 #include <type_traits>
 
@@ -125,6 +126,8 @@ LaserParticleContainer::LaserParticleContainer (AmrCore* amr_core, int ispecies,
         );
 
     pp_laser_name.query("do_continuous_injection", do_continuous_injection);
+    bool store_transverse_factor = true;
+    pp_laser_name.query("store_transverse_factor", store_transverse_factor);
     utils::parser::queryWithParser(pp_laser_name,
         "min_particles_per_mode", m_min_particles_per_mode);
 
@@ -277,6 +280,18 @@ LaserParticleContainer::LaserParticleContainer (AmrCore* amr_core, int ispecies,
     common_params.p_X = m_p_X;
     common_params.nvec = m_nvec;
     m_up_laser_profile->init(pp_laser_name, common_params);
+
+    // The time-independent factor of the amplitude is stored with the antenna
+    // particles, so that it is not recomputed at each step. It is computed in
+    // amrex::Real, so it is only stored if the particle attributes hold it exactly.
+    m_use_transverse_factor = store_transverse_factor &&
+        WarpXLaserProfiles::can_store_transverse_factor &&
+        m_up_laser_profile->has_transverse_factor();
+    if (m_use_transverse_factor) {
+        for (auto const& name : WarpXLaserProfiles::transverse_factor_names) {
+            AddRealComp(name);
+        }
+    }
 }
 
 /* \brief Check if laser particles enter the box, and inject if necessary.
@@ -548,12 +563,74 @@ LaserParticleContainer::InitData (int lev)
     if (Verbose()) { amrex::Print() << Utils::TextMsg::Info("Adding laser particles"); }
     amrex::Vector<amrex::Vector<ParticleReal>> attr;
     attr.push_back(particle_w);
+    if (m_use_transverse_factor) {
+        // The transverse factor is the first runtime attribute (see the constructor)
+        AMREX_ASSERT(GetRealCompIndex(WarpXLaserProfiles::transverse_factor_names[0]) == PIdx::nattribs);
+        for (auto& factor : ComputeTransverseFactor(particle_x, particle_y, particle_z)) {
+            attr.push_back(std::move(factor));
+        }
+    }
     const amrex::Vector<amrex::Vector<int>> attr_int;
     // Add particles on level 0. They will be redistributed afterwards
     AddNParticles(0,
                   np, particle_x, particle_y, particle_z,
                   particle_ux, particle_uy, particle_uz,
-                  1, attr, 0, attr_int, 1);
+                  static_cast<int>(attr.size()), attr, 0, attr_int, 1);
+}
+
+amrex::Vector<amrex::Vector<amrex::ParticleReal>>
+LaserParticleContainer::ComputeTransverseFactor (amrex::Vector<amrex::ParticleReal> const& x,
+                                                 amrex::Vector<amrex::ParticleReal> const& y,
+                                                 amrex::Vector<amrex::ParticleReal> const& z) const
+{
+    constexpr int ncomps = WarpXLaserProfiles::n_transverse_factor_comps;
+    const auto np = static_cast<int>(z.size());
+
+    // Coordinates of the particles in the plane of the antenna, computed
+    // as in calculate_laser_plane_coordinates, but before the particles
+    // are moved by the laser field
+    amrex::Vector<Real> h_plane_Xp(np, 0._rt), h_plane_Yp(np, 0._rt);
+    for (int i = 0; i < np; ++i) {
+#if defined(WARPX_DIM_3D) || defined(WARPX_DIM_RZ)
+        h_plane_Xp[i] = m_u_X[0] * (x[i] - m_position[0]) +
+                        m_u_X[1] * (y[i] - m_position[1]) +
+                        m_u_X[2] * (z[i] - m_position[2]);
+        h_plane_Yp[i] = m_u_Y[0] * (x[i] - m_position[0]) +
+                        m_u_Y[1] * (y[i] - m_position[1]) +
+                        m_u_Y[2] * (z[i] - m_position[2]);
+#elif defined(WARPX_DIM_XZ)
+        amrex::ignore_unused(y);
+        h_plane_Xp[i] = m_u_X[0] * (x[i] - m_position[0]) +
+                        m_u_X[2] * (z[i] - m_position[2]);
+#else
+        amrex::ignore_unused(x, y);
+#endif
+    }
+
+    Gpu::DeviceVector<Real> plane_Xp(np), plane_Yp(np);
+    Gpu::copyAsync(Gpu::hostToDevice, h_plane_Xp.begin(), h_plane_Xp.end(), plane_Xp.begin());
+    Gpu::copyAsync(Gpu::hostToDevice, h_plane_Yp.begin(), h_plane_Yp.end(), plane_Yp.begin());
+
+    std::array<Gpu::DeviceVector<Real>, ncomps> factor;
+    WarpXLaserProfiles::TransverseFactorOut factor_ptr;
+    for (int n = 0; n < ncomps; ++n) {
+        factor[n].resize(np);
+        factor_ptr[n] = factor[n].dataPtr();
+    }
+    m_up_laser_profile->fill_transverse_factor(np, plane_Xp.dataPtr(), plane_Yp.dataPtr(), factor_ptr);
+
+    amrex::Vector<amrex::Vector<Real>> h_factor(ncomps, amrex::Vector<Real>(np));
+    for (int n = 0; n < ncomps; ++n) {
+        Gpu::copyAsync(Gpu::deviceToHost, factor[n].begin(), factor[n].end(), h_factor[n].begin());
+    }
+    Gpu::streamSynchronize();
+
+    // The particle attributes hold the factor exactly (see can_store_transverse_factor)
+    amrex::Vector<amrex::Vector<ParticleReal>> attr(ncomps);
+    for (int n = 0; n < ncomps; ++n) {
+        attr[n].assign(h_factor[n].begin(), h_factor[n].end());
+    }
+    return attr;
 }
 
 void
@@ -642,16 +719,26 @@ LaserParticleContainer::Evolve (ablastr::fields::MultiFabRegister& fields,
             // Particle Push
             //
             WARPX_PROFILE_VAR_START(blp_pp);
-            // Find the coordinates of the particles in the emission plane
-            calculate_laser_plane_coordinates(pti, static_cast<int>(np),
-                                              plane_Xp.dataPtr(),
-                                              plane_Yp.dataPtr());
-
-            // Calculate the laser amplitude to be emitted,
-            // at the position of the emission plane
-            m_up_laser_profile->fill_amplitude(
-                static_cast<int>(np), plane_Xp.dataPtr(), plane_Yp.dataPtr(),
-                t_lab, amplitude_E.dataPtr());
+            if (m_use_transverse_factor) {
+                WarpXLaserProfiles::TransverseFactor factor;
+                for (int n = 0; n < WarpXLaserProfiles::n_transverse_factor_comps; ++n) {
+                    factor[n] = pti.GetAttribs(WarpXLaserProfiles::transverse_factor_names[n]).dataPtr();
+                }
+                // Calculate the laser amplitude to be emitted from the stored transverse factor
+                m_up_laser_profile->fill_amplitude_from_transverse_factor(
+                    static_cast<int>(np), factor, t_lab, amplitude_E.dataPtr());
+            } else {
+                // Find the coordinates of the particles in the emission plane
+                calculate_laser_plane_coordinates(pti, static_cast<int>(np),
+                                                  plane_Xp.dataPtr(),
+                                                  plane_Yp.dataPtr());
+
+                // Calculate the laser amplitude to be emitted,
+                // at the position of the emission plane
+                m_up_laser_profile->fill_amplitude(
+                    static_cast<int>(np), plane_Xp.dataPtr(), plane_Yp.dataPtr(),
+                    t_lab, amplitude_E.dataPtr());
+            }
 
             // Calculate the corresponding momentum and position for the particles
             update_laser_particle(pti, static_cast<int>(np), uxp.dataPtr(), uyp.dataPtr(),
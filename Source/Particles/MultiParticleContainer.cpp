@@ -688,6 +688,16 @@ MultiParticleContainer::GenerateGlobalDebyeLength ()
 
 }
 
+amrex::Long
+MultiParticleContainer::NumTileReallocations () const
+{
+    amrex::Long num_tile_reallocations = 0;
+    for (auto const& pc : allcontainers) {
+        num_tile_reallocations += pc->NumTileReallocations();
+    }
+    return num_tile_reallocations;
+}
+
 void
 MultiParticleContainer::SortParticlesByBin (
     const amrex::IntVect& bin_size,
@@ -940,19 +950,20 @@ MultiParticleContainer::SetDoBackTransformedParticles (const std::string& specie
            pc->SetDoBackTransformedParticles(do_back_transformed_particles);
 
            if ((!old_do_btd) && do_back_transformed_particles) {
-               // Set comm to false so that the attributes are not communicated
+               // These attributes are set before the push and read by the
+               // back-transformed diagnostics in the same step, before the particles
+               // are redistributed or sorted: they are not communicated, sorted
                // nor written to the checkpoint files
-               int const comm = 0;
 #if (AMREX_SPACEDIM >= 2)
-               pc->AddRealComp("x_n_btd", comm);
+               pc->AddStepLocalRealComp("x_n_btd");
 #endif
 #if defined(WARPX_DIM_3D) || defined(WARPX_DIM_RZ)
-               pc->AddRealComp("y_n_btd", comm);
+               pc->AddStepLocalRealComp("y_n_btd");
 #endif
-               pc->AddRealComp("z_n_btd", comm);
-               pc->AddRealComp("ux_n_btd", comm);
-               pc->AddRealComp("uy_n_btd", comm);
-               pc->AddRealComp("uz_n_btd", comm);
+               pc->AddStepLocalRealComp("z_n_btd");
+               pc->AddStepLocalRealComp("ux_n_btd");
+               pc->AddStepLocalRealComp("uy_n_btd");
+               pc->AddStepLocalRealComp("uz_n_btd");
            }
         }
     }
@@ -1058,10 +1069,11 @@ void MultiParticleContainer::CheckIonizationProductSpecies()
 }
 
 void MultiParticleContainer::ScrapeParticlesAtEB (
-    ablastr::fields::MultiLevelScalarField const& distance_to_eb)
+    ablastr::fields::MultiLevelScalarField const& distance_to_eb,
+    DistanceToEB::MultiLevelBoxType const& eb_box_type)
 {
     for (auto& pc : allcontainers) {
-        scrapeParticlesAtEB(*pc, distance_to_eb, ParticleBoundaryProcess::Absorb());
+        scrapeParticlesAtEB(*pc, distance_to_eb, eb_box_type, ParticleBoundaryProcess::Absorb());
     }
 }
 
@@ -461,7 +461,8 @@ void ParticleBoundaryBuffer::gatherParticlesFromDomainBoundaries (MultiParticleC
 }
 
 void ParticleBoundaryBuffer::gatherParticlesFromEmbeddedBoundaries (
-    MultiParticleContainer& mypc, ablastr::fields::MultiLevelScalarField const& distance_to_eb)
+    MultiParticleContainer& mypc, ablastr::fields::MultiLevelScalarField const& distance_to_eb,
+    DistanceToEB::MultiLevelBoxType const& eb_box_type)
 {
     if (EB::enabled()) {
         WARPX_PROFILE("ParticleBoundaryBuffer::gatherParticles::EB");
@@ -504,6 +505,9 @@ void ParticleBoundaryBuffer::gatherParticlesFromEmbeddedBoundaries (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
                 for (PIter pti(pc, lev); pti.isValid(); ++pti) {
+                    // no particle of this tile can be inside the embedded boundary
+                    if ((*eb_box_type[lev])[pti] == DistanceToEB::BoxType::regular_far) { continue; }
+
                     auto phiarr = (*distance_to_eb[lev])[pti].array();  // signed distance function
                     auto index = std::make_pair(pti.index(), pti.LocalTileIndex());
                     if (plevel.find(index) == plevel.end()) { continue; }
@@ -86,6 +86,7 @@
 #include <AMReX_ParticleContainerBase.H>
 #include <AMReX_AmrParticles.H>
 #include <AMReX_ParticleTile.H>
+#include <AMReX_ParticleTransformation.H>
 #include <AMReX_Print.H>
 #include <AMReX_Random.H>
 #include <AMReX_SPACE.H>
@@ -109,8 +110,10 @@
 #include <cstdlib>
 #include <limits>
 #include <map>
+#include <memory>
 #include <random>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <sstream>
@@ -211,6 +214,61 @@ namespace
 
         idcpu[ip] = amrex::ParticleIdCpus::Invalid;
     }
+
+    /**
+     * \brief Remove the invalid particles among the particles of a tile from index
+     * begin to the end, keeping the order of the valid ones. The cost is proportional
+     * to the number of particles after begin, not to the size of the tile.
+     *
+     * \param ptile particle tile
+     * \param begin index of the first particle that may be invalid
+     */
+    template <typename PTile>
+    void RemoveInvalidParticlesFrom (PTile& ptile, amrex::Long begin)
+    {
+        auto& soa = ptile.GetStructOfArrays();
+        const auto n = static_cast<int>(static_cast<amrex::Long>(ptile.size()) - begin);
+        if (n <= 0) { return; }
+
+        // Index (relative to begin) of each valid particle, in order
+        uint64_t * const AMREX_RESTRICT idcpu = soa.GetIdCPUData().data() + begin;
+        amrex::Gpu::DeviceVector<int> src_index(n);
+        int * const AMREX_RESTRICT psrc = src_index.data();
+        const int n_valid = amrex::Scan::PrefixSum<int>(n,
+            [=] AMREX_GPU_DEVICE (int i) -> int
+            {
+                return amrex::ParticleIDWrapper{idcpu[i]}.is_valid() ? 1 : 0;
+            },
+            [=] AMREX_GPU_DEVICE (int i, int const& s)
+            {
+                if (amrex::ParticleIDWrapper{idcpu[i]}.is_valid()) { psrc[s] = i; }
+            },
+            amrex::Scan::Type::exclusive, amrex::Scan::retSum);
+        if (n_valid == n) { return; }
+
+        // Gather the valid particles in a temporary tile, and copy them back from begin.
+        // Each of the two kernels copies all the components of the particles.
+        PTile tmp;
+        tmp.define(ptile.NumRuntimeRealComps(), ptile.NumRuntimeIntComps());
+        tmp.resize(n_valid);
+        const auto ibegin = static_cast<int>(begin);
+        const auto src_data = ptile.getConstParticleTileData();
+        const auto dst_data = ptile.getParticleTileData();
+        const auto tmp_src_data = tmp.getConstParticleTileData();
+        const auto tmp_dst_data = tmp.getParticleTileData();
+        amrex::ParallelFor(n_valid, [=] AMREX_GPU_DEVICE (int i)
+        {
+            amrex::copyParticle(tmp_dst_data, src_data, ibegin + psrc[i], i);
+        });
+        amrex::ParallelFor(n_valid, [=] AMREX_GPU_DEVICE (int i)
+        {
+            amrex::copyParticle(dst_data, tmp_src_data, i, ibegin + i);
+        });
+        // The temporary tile and src_index are freed at the end of the scope
+        amrex::Gpu::streamSynchronize();
+
+        ptile.resize(begin + n_valid);
+    }
 }
 
 PhysicalParticleContainer::PhysicalParticleContainer (AmrCore* amr_core, int ispecies,
@@ -298,6 +356,7 @@ PhysicalParticleContainer::PhysicalParticleContainer (AmrCore* amr_core, int isp
     pp_species_name.query("boost_adjust_transverse_positions", boost_adjust_transverse_positions);
     pp_species_name.query("do_backward_propagation", do_backward_propagation);
     pp_species_name.query("random_theta", m_rz_random_theta);
+    pp_species_name.query("flux_injection_in_place", m_flux_injection_in_place);
 
     // Initialize splitting
     pp_species_name.query("do_splitting", do_splitting);
@@ -306,6 +365,13 @@ PhysicalParticleContainer::PhysicalParticleContainer (AmrCore* amr_core, int isp
     pp_species_name.query("do_not_gather", do_not_gather);
     pp_species_name.query("do_not_push", do_not_push);
 
+    // Capacity policy of the particle tiles
+    utils::parser::queryWithParser(pp_species_name, "tile_capacity_growth", m_tile_capacity_growth);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_tile_capacity_growth >= 1._rt,
+        species_name + ".tile_capacity_growth must be at least 1");
+    utils::parser::queryWithParser(pp_species_name, "tile_reserve", m_tile_reserve);
+    pp_species_name.query("shrink_tiles_on_sort", m_shrink_tiles_on_sort);
+
     pp_species_name.query("do_continuous_injection", do_continuous_injection);
     pp_species_name.query("initialize_self_fields", initialize_self_fields);
     utils::parser::queryWithParser(
@@ -926,6 +992,8 @@ PhysicalParticleContainer::AddPlasma (PlasmaInjector const& plasma_injector, int
 {
     WARPX_PROFILE("PhysicalParticleContainer::AddPlasma()");
 
+    BumpDataGeneration();
+
     // If no part_realbox is provided, initialize particles in the whole domain
     const Geometry& geom = Geom(lev);
     if (!part_realbox.ok()) { part_realbox = geom.ProbDomain(); }
@@ -1361,13 +1429,31 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
 
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(0);
 
-    // Create temporary particle container to which particles will be added;
-    // we will then call Redistribute on this new container and finally
-    // add the new particles to the original container.
-    PhysicalParticleContainer tmp_pc(&WarpX::GetInstance());
-    for (int ic = 0; ic < NumRuntimeRealComps(); ++ic) { tmp_pc.AddRealComp(GetRealSoANames()[ic + NArrayReal], false); }
-    for (int ic = 0; ic < NumRuntimeIntComps(); ++ic) { tmp_pc.AddIntComp(GetIntSoANames()[ic + NArrayInt], false); }
-    tmp_pc.defineAllParticleTiles();
+    // The new particles are written in place at the end of the tiles of this container,
+    // and the invalid ones are removed from each tile right away. The few particles that
+    // end up out of their tile are moved by the redistribution that follows the
+    // injection in the PIC loop (see WarpX::HandleParticlesAtBoundaries).
+    // A temporary container is used instead when the particles must be scraped at the
+    // embedded boundaries, or when they can be moved far from their tile (RZ flux
+    // injection without radial weighting): we then call Redistribute on this container
+    // and finally add the new particles to the original container.
+    bool use_tmp_pc = EB::enabled() || !m_flux_injection_in_place;
+#ifdef WARPX_DIM_RZ
+    if (plasma_injector.flux_normal_axis != 1 && !plasma_injector.radially_weighted) {
+        use_tmp_pc = true;
+    }
+#endif
+    std::unique_ptr<PhysicalParticleContainer> tmp_pc;
+    if (use_tmp_pc) {
+        tmp_pc = std::make_unique<PhysicalParticleContainer>(&WarpX::GetInstance());
+        for (int ic = 0; ic < NumRuntimeRealComps(); ++ic) { tmp_pc->AddRealComp(GetRealSoANames()[ic + NArrayReal], false); }
+        for (int ic = 0; ic < NumRuntimeIntComps(); ++ic) { tmp_pc->AddIntComp(GetIntSoANames()[ic + NArrayInt], false); }
+        tmp_pc->defineAllParticleTiles();
+    } else {
+        defineAllParticleTiles();
+    }
+    PhysicalParticleContainer& dst_pc = use_tmp_pc ? *tmp_pc : *this;
+    BumpDataGeneration();
 
     Box fine_injection_box;
     amrex::IntVect rrfac(AMREX_D_DECL(1,1,1));
@@ -1509,8 +1595,10 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
 
         const int cpuid = ParallelDescriptor::MyProc();
 
-        auto& particle_tile = tmp_pc.DefineAndReturnParticleTile(0, grid_id, tile_id);
+        auto& particle_tile = dst_pc.DefineAndReturnParticleTile(0, grid_id, tile_id);
 
+        // The capacity of the tile is kept when the invalid particles are removed,
+        // so that it is only reallocated when the number of particles grows
         auto const old_size = static_cast<amrex::Long>(particle_tile.size());
         auto const new_size = old_size + max_new_particles;
         particle_tile.resize(new_size);
@@ -1547,8 +1635,8 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
 
         // Loop over all new particles and inject them (creates too many
         // particles, in particular does not consider xmin, xmax etc.).
-        // The invalid ones are given negative ID and are deleted during the
-        // next redistribute.
+        // The invalid ones are given negative ID and are deleted below, or
+        // during the redistribute of the temporary container.
         auto *const poffset = offset.data();
         amrex::ParallelForRNG(overlap_box,
         [=] AMREX_GPU_DEVICE (int i, int j, int k, amrex::RandomEngine const& engine) noexcept
@@ -1769,6 +1857,10 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
 
         amrex::Gpu::synchronize();
 
+        if (!use_tmp_pc) {
+            RemoveInvalidParticlesFrom(particle_tile, old_size);
+        }
+
         if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
         {
             wt = static_cast<amrex::Real>(amrex::second()) - wt;
@@ -1776,6 +1868,8 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
         }
     }
 
+    if (!use_tmp_pc) { return; }
+
     // Remove particles that are inside the embedded boundaries
 #ifdef AMREX_USE_EB
     if (EB::enabled())
@@ -1783,7 +1877,7 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
         using warpx::fields::FieldType;
         auto & warpx = WarpX::GetInstance();
         scrapeParticlesAtEB(
-            tmp_pc,
+            *tmp_pc,
             warpx.m_fields.get_mr_levels(FieldType::distance_to_eb, warpx.finestLevel()),
             ParticleBoundaryProcess::Absorb());
     }
@@ -1792,10 +1886,10 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
     // Redistribute the new particles that were added to the temporary container.
     // (This eliminates invalid particles, and makes sure that particles
     // are in the right tile.)
-    tmp_pc.Redistribute();
+    tmp_pc->Redistribute();
 
     // Add the particles to the current container
-    this->addParticles(tmp_pc, true);
+    this->addParticles(*tmp_pc, true);
 }
 
 void
@@ -2336,6 +2430,7 @@ PhysicalParticleContainer::SplitParticles (int lev)
     // Copy particles from tmp to current particle container
     constexpr bool local_flag = true;
     addParticles(pctmp_split,local_flag);
+    BumpDataGeneration();
     // Clear tmp container
     pctmp_split.clearParticles();
 }
@@ -57,6 +57,8 @@ PhysicalParticleContainer::PartitionParticlesInBuffers(
 {
     WARPX_PROFILE("PhysicalParticleContainer::PartitionParticlesInBuffers");
 
+    BumpDataGeneration();
+
     // Initialize temporary arrays
     Gpu::DeviceVector<int> inexflag;
     inexflag.resize(np);
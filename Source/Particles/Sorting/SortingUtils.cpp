@@ -8,6 +8,15 @@
 
 #include "SortingUtils.H"
 
+#ifdef AMREX_USE_OMP
+#   include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
 void fillWithConsecutiveIntegers( amrex::Gpu::DeviceVector<int>& v )
 {
 #ifdef AMREX_USE_GPU
@@ -20,3 +29,96 @@ void fillWithConsecutiveIntegers( amrex::Gpu::DeviceVector<int>& v )
     std::iota( v.begin(), v.end(), 0L );
 #endif
 }
+
+void parallelBinPermutationCPU( const unsigned int* bin_index, unsigned int np,
+                                unsigned int nbins, unsigned int* permutation )
+{
+    // Below this number of items, the threads cost more than they save. Each thread
+    // also needs one count per bin, so giving each thread at least nbins items keeps
+    // the nthreads*nbins scratch below np (e.g. for fine bins of a large tile)
+    constexpr unsigned int min_items_per_thread = 4096;
+#ifdef AMREX_USE_OMP
+    const unsigned int items_per_thread_min = std::max(min_items_per_thread, nbins);
+    const int max_threads = std::max(1, std::min(omp_get_max_threads(),
+                                                 static_cast<int>(np/items_per_thread_min)));
+#endif
+
+    // The split of the items and bins across the threads is derived from the number
+    // of threads actually running the parallel region, which can be smaller than
+    // requested (e.g. with OMP_DYNAMIC, OMP_THREAD_LIMIT or nested parallelism)
+    int nthreads = 1;
+    unsigned int items_per_thread = np;
+    unsigned int bins_per_thread = nbins;
+    // Count of each bin in the items of each thread (offsets[t*nbins + b]),
+    // which is then replaced by the position of the first of these items
+    std::vector<unsigned int> offsets;
+    std::vector<unsigned int> bin_range_sum;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel num_threads(max_threads)
+#endif
+    {
+#ifdef AMREX_USE_OMP
+#pragma omp single
+#endif
+        {
+#ifdef AMREX_USE_OMP
+            nthreads = omp_get_num_threads();
+#endif
+            items_per_thread = (np + nthreads - 1)/nthreads;
+            bins_per_thread = (nbins + nthreads - 1)/nthreads;
+            offsets.assign(static_cast<std::size_t>(nthreads)*nbins, 0);
+            bin_range_sum.assign(nthreads+1, 0);
+        } // implicit barrier
+
+#ifdef AMREX_USE_OMP
+        const int t = omp_get_thread_num();
+#else
+        const int t = 0;
+#endif
+        const unsigned int item_begin = std::min(np, t*items_per_thread);
+        const unsigned int item_end = std::min(np, item_begin + items_per_thread);
+        const unsigned int bin_begin = std::min(nbins, t*bins_per_thread);
+        const unsigned int bin_end = std::min(nbins, bin_begin + bins_per_thread);
+        unsigned int* const AMREX_RESTRICT my_offsets = offsets.data() + static_cast<std::size_t>(t)*nbins;
+
+        // Histogram of the items of this thread
+        for (unsigned int i = item_begin; i < item_end; ++i) {
+            ++my_offsets[bin_index[i]];
+        }
+#ifdef AMREX_USE_OMP
+#pragma omp barrier
+#endif
+        // Number of items in the bins of this thread
+        unsigned int sum = 0;
+        for (unsigned int b = bin_begin; b < bin_end; ++b) {
+            for (int tt = 0; tt < nthreads; ++tt) {
+                sum += offsets[static_cast<std::size_t>(tt)*nbins + b];
+            }
+        }
+        bin_range_sum[t+1] = sum;
+#ifdef AMREX_USE_OMP
+#pragma omp barrier
+#pragma omp single
+#endif
+        std::partial_sum(bin_range_sum.begin(), bin_range_sum.end(), bin_range_sum.begin());
+
+        // Exclusive scan in the order (bin, thread), for the bins of this thread
+        unsigned int running = bin_range_sum[t];
+        for (unsigned int b = bin_begin; b < bin_end; ++b) {
+            for (int tt = 0; tt < nthreads; ++tt) {
+                unsigned int& count = offsets[static_cast<std::size_t>(tt)*nbins + b];
+                const unsigned int n = count;
+                count = running;
+                running += n;
+            }
+        }
+#ifdef AMREX_USE_OMP
+#pragma omp barrier
+#endif
+        // Scatter the items of this thread, in their original order
+        for (unsigned int i = item_begin; i < item_end; ++i) {
+            permutation[my_offsets[bin_index[i]]++] = i;
+        }
+    }
+}
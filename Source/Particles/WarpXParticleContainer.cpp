@@ -12,12 +12,15 @@
 #include "ablastr/particles/DepositCharge.H"
 #include "Deposition/ChargeDeposition.H"
 #include "Deposition/CurrentDeposition.H"
+#include "Deposition/MassMatrixDeposition.H"
 #include "Deposition/SharedDepositionUtils.H"
 #include "EmbeddedBoundary/Enabled.H"
 #include "Fields.H"
 #include "Pusher/GetAndSetPosition.H"
 #include "Pusher/UpdatePosition.H"
+#include "Sorting/SortingUtils.H"
 #include "ParticleBoundaries_K.H"
+#include "Utils/ScratchMultiFabPool.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXAlgorithmSelection.H"
 #include "Utils/WarpXConst.H"
@@ -41,6 +44,7 @@
 #include <AMReX_Geometry.H>
 #include <AMReX_GpuAllocators.H>
 #include <AMReX_GpuAtomic.H>
+#include <AMReX_GpuContainers.H>
 #include <AMReX_GpuControl.H>
 #include <AMReX_GpuDevice.H>
 #include <AMReX_GpuLaunch.H>
@@ -73,9 +77,118 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <type_traits>
 
 using namespace amrex;
 
+namespace
+{
+    /**
+     * \brief Add the current deposited in a thread-local tile array to the current MultiFab
+     *
+     * When the local array has a wider type than amrex::Real (double-precision accumulation
+     * with single-precision fields), it is first rounded into the scratch array rounded.
+     *
+     * \param[in,out] j_fab FArrayBox of the current MultiFab
+     * \param[in] local_j thread-local array in which the particles of the tile deposited
+     * \param[in,out] rounded thread-local scratch array
+     * \param[in] bx box over which local_j is added
+     * \param[in] ncomp number of components
+     */
+    template <typename LocalFab>
+    void AddLocalCurrent (amrex::FArrayBox& j_fab, LocalFab const& local_j,
+                          amrex::FArrayBox& rounded, amrex::Box const& bx, int ncomp)
+    {
+        if constexpr (std::is_same_v<typename LocalFab::value_type, amrex::Real>) {
+            amrex::ignore_unused(rounded);
+            j_fab.lockAdd(local_j, bx, bx, 0, 0, ncomp);
+        } else {
+            rounded.resize(bx, ncomp);
+            amrex::Array4<amrex::Real> const& rounded_arr = rounded.array();
+            auto const& local_arr = local_j.const_array();
+            amrex::LoopOnCpu(bx, ncomp, [=] (int i, int j, int k, int n) noexcept
+            {
+                rounded_arr(i,j,k,n) = static_cast<amrex::Real>(local_arr(i,j,k,n));
+            });
+            j_fab.lockAdd(rounded, bx, bx, 0, 0, ncomp);
+        }
+    }
+
+    /** Replace the first np elements of data by data[permutation[i]] */
+    template <typename Vector>
+    void PermuteComponent (Vector& data, const unsigned int* permutation,
+                           long np, long np_total, bool keep_capacity)
+    {
+        Vector tmp;
+        if (keep_capacity) { tmp.reserve(data.capacity()); }
+        tmp.resize(np_total);
+        auto const* const AMREX_RESTRICT src = data.dataPtr();
+        auto* const AMREX_RESTRICT dst = tmp.dataPtr();
+        amrex::ParallelFor(np_total, [=] AMREX_GPU_DEVICE (long i) noexcept
+        {
+            dst[i] = (i < np) ? src[permutation[i]] : src[i];
+        });
+        amrex::Gpu::streamSynchronize();
+        data.swap(tmp);
+    }
+
+#ifndef AMREX_USE_GPU
+    /**
+     * \brief Replace the first np elements of all the components by their element permutation[i]
+     *
+     * The particles are processed by blocks, split across the OpenMP threads, and all the
+     * components are permuted for a block before moving to the next one, so that the
+     * indices of the block are read only once from memory. This needs the temporary memory
+     * of all the components at once.
+     */
+    template <typename RealVector, typename IntVector, typename IdCPUVector>
+    void PermuteComponentsCPU (amrex::Vector<RealVector*> const& real_data,
+                               amrex::Vector<IntVector*> const& int_data,
+                               IdCPUVector& idcpu_data,
+                               const unsigned int* permutation, long np, long np_total,
+                               bool keep_capacity)
+    {
+        amrex::Vector<RealVector> real_tmp(real_data.size());
+        amrex::Vector<IntVector> int_tmp(int_data.size());
+        IdCPUVector idcpu_tmp;
+        const auto allocate = [=] (auto& tmp, auto const& data) {
+            if (keep_capacity) { tmp.reserve(data.capacity()); }
+            tmp.resize(np_total);
+        };
+        for (std::size_t comp = 0; comp < real_data.size(); ++comp) { allocate(real_tmp[comp], *real_data[comp]); }
+        for (std::size_t comp = 0; comp < int_data.size(); ++comp) { allocate(int_tmp[comp], *int_data[comp]); }
+        allocate(idcpu_tmp, idcpu_data);
+
+        constexpr long block_size = 2048;
+        const long nblocks = (np_total + block_size - 1)/block_size;
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for if (nblocks > 4)
+#endif
+        for (long ib = 0; ib < nblocks; ++ib) {
+            const long begin = ib*block_size;
+            const long end = std::min(begin + block_size, np_total);
+            const auto gather = [=] (auto const* AMREX_RESTRICT src, auto* AMREX_RESTRICT dst) {
+                for (long i = begin; i < end; ++i) {
+                    dst[i] = (i < np) ? src[permutation[i]] : src[i];
+                }
+            };
+            for (std::size_t comp = 0; comp < real_data.size(); ++comp) {
+                gather(real_data[comp]->dataPtr(), real_tmp[comp].dataPtr());
+            }
+            for (std::size_t comp = 0; comp < int_data.size(); ++comp) {
+                gather(int_data[comp]->dataPtr(), int_tmp[comp].dataPtr());
+            }
+            gather(idcpu_data.dataPtr(), idcpu_tmp.dataPtr());
+        }
+
+        for (std::size_t comp = 0; comp < real_data.size(); ++comp) { real_data[comp]->swap(real_tmp[comp]); }
+        for (std::size_t comp = 0; comp < int_data.size(); ++comp) { int_data[comp]->swap(int_tmp[comp]); }
+        idcpu_data.swap(idcpu_tmp);
+    }
+#endif
+}
+
 WarpXParIter::WarpXParIter (ContainerType& pc, int level)
     : amrex::ParIterSoA<PIdx::nattribs, 0>(pc, level,
              MFItInfo().SetDynamic(WarpX::do_dynamic_scheduling))
@@ -124,6 +237,7 @@ WarpXParticleContainer::WarpXParticleContainer (AmrCore* amr_core, int ispecies)
     local_jx.resize(num_threads);
     local_jy.resize(num_threads);
     local_jz.resize(num_threads);
+    local_j_rounded.resize(num_threads);
 
     // The boundary conditions are read in in ReadBCParams but a child class
     // can allow these value to be overwritten if different boundary
@@ -320,6 +434,7 @@ WarpXParticleContainer::AddNParticles (int /*lev*/, long n,
 
 void
 WarpXParticleContainer::deleteInvalidParticles () {
+    BumpDataGeneration();
     const int nLevels = finestLevel();
     for (int lev = 0; lev <= nLevels; ++lev) {
 #ifdef AMREX_USE_OMP
@@ -332,6 +447,200 @@ WarpXParticleContainer::deleteInvalidParticles () {
     }
 }
 
+void
+WarpXParticleContainer::Redistribute (int lev_min, int lev_max, int nGrow, int local,
+                                      bool remove_negative)
+{
+    BumpDataGeneration();
+    amrex::ParticleContainerPureSoA<PIdx::nattribs, 0, amrex::DefaultAllocator>::Redistribute(
+        lev_min, lev_max, nGrow, local, remove_negative);
+}
+
+void
+WarpXParticleContainer::BumpDataGeneration ()
+{
+    // the tiles of a species can be resized or reordered by several threads
+#ifdef AMREX_USE_OMP
+#pragma omp atomic update
+#endif
+    ++m_data_generation;
+}
+
+void
+WarpXParticleContainer::AddStepLocalRealComp (const std::string& name)
+{
+    // Step-local attributes are not communicated
+    // nor written to the checkpoint files
+    int const comm = 0;
+    AddRealComp(name, comm);
+    m_step_local_real_comps.push_back(GetRealCompIndex(name));
+}
+
+bool
+WarpXParticleContainer::IsStepLocalRealComp (int comp) const
+{
+    return std::find(m_step_local_real_comps.begin(), m_step_local_real_comps.end(), comp)
+        != m_step_local_real_comps.end();
+}
+
+void
+WarpXParticleContainer::SortParticlesByBin (amrex::IntVect bin_size)
+{
+    WARPX_PROFILE("WarpXParticleContainer::SortParticlesByBin()");
+
+    if (bin_size == amrex::IntVect::TheZeroVector()) { return; }
+
+    for (int lev = 0; lev <= finestLevel(); ++lev)
+    {
+        const Geometry& geom = Geom(lev);
+        const auto dxi = geom.InvCellSizeArray();
+        const auto plo = geom.ProbLoArray();
+        const auto domain = geom.Domain();
+
+        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
+        {
+            auto& ptile = ParticlesAt(lev, pti);
+            const Box box = pti.validbox();
+            const int ntiles = numTilesInBox(box, true, bin_size);
+
+#ifdef AMREX_USE_GPU
+            amrex::DenseBins<ParticleTileType::ParticleTileDataType> bins;
+            bins.build(ptile.numParticles(), ptile.getParticleTileData(), ntiles,
+                [=] AMREX_GPU_HOST_DEVICE (const ParticleType& p) -> unsigned int
+                {
+                    Box tbox;
+                    auto iv = getParticleCell(p, plo, dxi, domain);
+                    return static_cast<unsigned int>(getTileIndex(iv, box, true, bin_size, tbox));
+                });
+
+            ReorderParticlesExceptStepLocal(lev, pti, bins.permutationPtr());
+#else
+            // On CPU, the bins of a tile are computed and sorted by all the threads,
+            // which balances the work when the tiles have very different numbers of particles
+            const auto np = static_cast<unsigned int>(ptile.numParticles());
+            const auto ptd = ptile.getConstParticleTileData();
+            amrex::Vector<unsigned int> bin_index(np);
+            amrex::Vector<unsigned int> permutation(np);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for if (np > 4096)
+#endif
+            for (unsigned int i = 0; i < np; ++i) {
+                Box tbox;
+                auto iv = getParticleCell(ptd, i, plo, dxi, domain);
+                bin_index[i] = static_cast<unsigned int>(getTileIndex(iv, box, true, bin_size, tbox));
+            }
+            parallelBinPermutationCPU(bin_index.data(), np, static_cast<unsigned int>(ntiles),
+                                      permutation.data());
+
+            ReorderParticlesExceptStepLocal(lev, pti, permutation.data());
+#endif
+        }
+    }
+}
+
+void
+WarpXParticleContainer::SortParticlesForDeposition (amrex::IntVect idx_type)
+{
+    WARPX_PROFILE("WarpXParticleContainer::SortParticlesForDeposition()");
+
+    for (int lev = 0; lev <= finestLevel(); ++lev)
+    {
+        const Geometry& geom = Geom(lev);
+
+        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
+        {
+            auto& ptile = ParticlesAt(lev, pti);
+            const auto np = static_cast<unsigned int>(ptile.numParticles());
+
+            amrex::Gpu::DeviceVector<unsigned int> permutation;
+            amrex::PermutationForDeposition<unsigned int>(
+                permutation, np, ptile, pti.validbox(), geom, idx_type);
+
+            ReorderParticlesExceptStepLocal(lev, pti, permutation.dataPtr());
+        }
+    }
+}
+
+void
+WarpXParticleContainer::ReorderParticlesExceptStepLocal (
+    int lev, const amrex::MFIter& mfi, const unsigned int* permutation)
+{
+    auto& ptile = ParticlesAt(lev, mfi);
+    auto& soa = ptile.GetStructOfArrays();
+    const auto np = static_cast<long>(ptile.numParticles());
+    const auto np_total = np + static_cast<long>(ptile.numNeighborParticles());
+
+    if (np == 0) { return; }
+
+    BumpDataGeneration();
+
+    // The permuted components are copied into new arrays, which keep the capacity of
+    // the tile (see ResizeTileWithReserve) unless it is reduced to its size on sort
+    const bool keep_capacity = !m_shrink_tiles_on_sort;
+    if (m_shrink_tiles_on_sort) {
+        for (int comp = 0; comp < NumRealComps(); ++comp) {
+            if (IsStepLocalRealComp(comp)) { soa.GetRealData(comp).shrink_to_fit(); }
+        }
+    }
+
+#ifndef AMREX_USE_GPU
+    // On CPU, all the components in one pass over blocks of particles
+    amrex::Vector<std::remove_reference_t<decltype(soa.GetRealData(0))>*> real_data;
+    amrex::Vector<std::remove_reference_t<decltype(soa.GetIntData(0))>*> int_data;
+    for (int comp = 0; comp < NumRealComps(); ++comp) {
+        // step-local attributes are reset before being read in the next step
+        if (IsStepLocalRealComp(comp)) { continue; }
+        real_data.push_back(&soa.GetRealData(comp));
+    }
+    for (int comp = 0; comp < NumIntComps(); ++comp) {
+        int_data.push_back(&soa.GetIntData(comp));
+    }
+    PermuteComponentsCPU(real_data, int_data, soa.GetIdCPUData(), permutation, np, np_total,
+                         keep_capacity);
+#else
+    // One component at a time, as amrex::ParticleContainer::ReorderParticles
+    // does with memEfficientSort, to limit the temporary memory
+    for (int comp = 0; comp < NumRealComps(); ++comp) {
+        // step-local attributes are reset before being read in the next step
+        if (IsStepLocalRealComp(comp)) { continue; }
+        PermuteComponent(soa.GetRealData(comp), permutation, np, np_total, keep_capacity);
+    }
+    for (int comp = 0; comp < NumIntComps(); ++comp) {
+        PermuteComponent(soa.GetIntData(comp), permutation, np, np_total, keep_capacity);
+    }
+    PermuteComponent(soa.GetIdCPUData(), permutation, np, np_total, keep_capacity);
+#endif
+}
+
+void
+WarpXParticleContainer::ResizeTileWithReserve (ParticleTileType& ptile, amrex::Long new_np)
+{
+    auto& soa = ptile.GetStructOfArrays();
+    const auto capacity = static_cast<amrex::Long>(soa.GetIdCPUData().capacity());
+
+    if (new_np > capacity) {
+        const auto grown_np = static_cast<amrex::Long>(
+            m_tile_capacity_growth * static_cast<amrex::Real>(new_np));
+        const auto new_capacity = static_cast<std::size_t>(
+            std::max({new_np, grown_np, m_tile_reserve}));
+        for (int comp = 0; comp < soa.NumRealComps(); ++comp) {
+            soa.GetRealData(comp).reserve(new_capacity);
+        }
+        for (int comp = 0; comp < soa.NumIntComps(); ++comp) {
+            soa.GetIntData(comp).reserve(new_capacity);
+        }
+        soa.GetIdCPUData().reserve(new_capacity);
+        // the tiles of a species can be resized by several threads
+#ifdef AMREX_USE_OMP
+#pragma omp atomic update
+#endif
+        ++m_num_tile_reallocations;
+    }
+
+    BumpDataGeneration();
+    ptile.resize(new_np);
+}
+
 /* \brief Current Deposition for thread thread_num
  * \param pti         Particle iterator
  * \param wp          Array of particle weights
@@ -469,9 +778,9 @@ WarpXParticleContainer::DepositCurrent (WarpXParIter& pti,
     auto & jx_fab = local_jx[thread_num];
     auto & jy_fab = local_jy[thread_num];
     auto & jz_fab = local_jz[thread_num];
-    Array4<Real> const& jx_arr = local_jx[thread_num].array();
-    Array4<Real> const& jy_arr = local_jy[thread_num].array();
-    Array4<Real> const& jz_arr = local_jz[thread_num].array();
+    Array4<DepositionReal> const& jx_arr = local_jx[thread_num].array();
+    Array4<DepositionReal> const& jy_arr = local_jy[thread_num].array();
+    Array4<DepositionReal> const& jz_arr = local_jz[thread_num].array();
 #endif
 
     const auto GetPosition = GetParticlePosition<PIdx>(pti, offset);
@@ -862,9 +1171,9 @@ WarpXParticleContainer::DepositCurrent (WarpXParIter& pti,
 #ifndef AMREX_USE_GPU
     // CPU, tiling: atomicAdd local_j<xyz> into j<xyz>
     WARPX_PROFILE_VAR_START(blp_accumulate);
-    (*jx)[pti].lockAdd(local_jx[thread_num], tbx, tbx, 0, 0, jx->nComp());
-    (*jy)[pti].lockAdd(local_jy[thread_num], tby, tby, 0, 0, jy->nComp());
-    (*jz)[pti].lockAdd(local_jz[thread_num], tbz, tbz, 0, 0, jz->nComp());
+    AddLocalCurrent((*jx)[pti], local_jx[thread_num], local_j_rounded[thread_num], tbx, jx->nComp());
+    AddLocalCurrent((*jy)[pti], local_jy[thread_num], local_j_rounded[thread_num], tby, jy->nComp());
+    AddLocalCurrent((*jz)[pti], local_jz[thread_num], local_j_rounded[thread_num], tbz, jz->nComp());
     WARPX_PROFILE_VAR_STOP(blp_accumulate);
 #endif
 }
@@ -910,6 +1219,123 @@ WarpXParticleContainer::DepositCurrent (
     }
 }
 
+void
+WarpXParticleContainer::DepositMassMatrices (
+    ablastr::fields::MultiLevelVectorField const & M, const amrex::Real dt)
+{
+    WARPX_PROFILE("WarpXParticleContainer::DepositMassMatrices()");
+
+    // Species without charge (e.g. photons) do not respond to E
+    if (do_not_deposit || charge == 0._rt) { return; }
+
+    const WarpX& warpx = WarpX::GetInstance();
+    const amrex::IntVect& ng_J = warpx.get_ng_depos_J();
+    const amrex::ParticleReal q = this->charge;
+    const amrex::ParticleReal m = this->mass;
+
+    auto const finest_level = static_cast<int>(M.size() - 1);
+    for (int lev = 0; lev <= finest_level; ++lev)
+    {
+        amrex::MultiFab * const mx = M[lev][0];
+        amrex::MultiFab * const my = M[lev][1];
+        amrex::MultiFab * const mz = M[lev][2];
+        const amrex::XDim3 dinv = WarpX::InvCellSize(lev);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+        {
+        const int thread_num = omp_get_thread_num();
+#else
+        const int thread_num = 0;
+#endif
+        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti)
+        {
+            const long np = pti.numParticles();
+            if (np == 0) { continue; }
+
+            const auto & wp = pti.GetAttribs(PIdx::w);
+            const auto & uxp = pti.GetAttribs(PIdx::ux);
+            const auto & uyp = pti.GetAttribs(PIdx::uy);
+            const auto & uzp = pti.GetAttribs(PIdx::uz);
+            const auto & uxp_n = pti.GetAttribs("ux_n");
+            const auto & uyp_n = pti.GetAttribs("uy_n");
+            const auto & uzp_n = pti.GetAttribs("uz_n");
+
+            int* AMREX_RESTRICT ion_lev = nullptr;
+            if (do_field_ionization)
+            {
+                ion_lev = pti.GetiAttribs("ionizationLevel").dataPtr();
+            }
+
+            Box tilebox = pti.tilebox();
+#ifndef AMREX_USE_GPU
+            // Same thread-local tile arrays as for the current deposition
+            Box tbx = convert( tilebox, mx->ixType().toIntVect() );
+            Box tby = convert( tilebox, my->ixType().toIntVect() );
+            Box tbz = convert( tilebox, mz->ixType().toIntVect() );
+#endif
+            tilebox.grow(ng_J);
+
+#ifdef AMREX_USE_GPU
+            amrex::ignore_unused(thread_num);
+            auto & mx_fab = mx->get(pti);
+            auto & my_fab = my->get(pti);
+            auto & mz_fab = mz->get(pti);
+#else
+            tbx.grow(ng_J);
+            tby.grow(ng_J);
+            tbz.grow(ng_J);
+
+            local_jx[thread_num].resize(tbx, mx->nComp());
+            local_jy[thread_num].resize(tby, my->nComp());
+            local_jz[thread_num].resize(tbz, mz->nComp());
+            local_jx[thread_num].setVal(0.0);
+            local_jy[thread_num].setVal(0.0);
+            local_jz[thread_num].setVal(0.0);
+
+            auto & mx_fab = local_jx[thread_num];
+            auto & my_fab = local_jy[thread_num];
+            auto & mz_fab = local_jz[thread_num];
+#endif
+
+            const auto GetPosition = GetParticlePosition<PIdx>(pti);
+            const Dim3 lo = lbound(tilebox);
+            const amrex::XDim3 xyzmin = WarpX::LowerCorner(tilebox, lev, 0.5_rt*dt);
+
+            if        (WarpX::nox == 1){
+                doMassMatrixDepositionShapeNImplicit<1>(
+                    GetPosition, wp.dataPtr(), uxp_n.dataPtr(), uyp_n.dataPtr(), uzp_n.dataPtr(),
+                    uxp.dataPtr(), uyp.dataPtr(), uzp.dataPtr(), ion_lev,
+                    mx_fab, my_fab, mz_fab, np, dt, dinv, xyzmin, lo, q, m);
+            } else if (WarpX::nox == 2){
+                doMassMatrixDepositionShapeNImplicit<2>(
+                    GetPosition, wp.dataPtr(), uxp_n.dataPtr(), uyp_n.dataPtr(), uzp_n.dataPtr(),
+                    uxp.dataPtr(), uyp.dataPtr(), uzp.dataPtr(), ion_lev,
+                    mx_fab, my_fab, mz_fab, np, dt, dinv, xyzmin, lo, q, m);
+            } else if (WarpX::nox == 3){
+                doMassMatrixDepositionShapeNImplicit<3>(
+                    GetPosition, wp.dataPtr(), uxp_n.dataPtr(), uyp_n.dataPtr(), uzp_n.dataPtr(),
+                    uxp.dataPtr(), uyp.dataPtr(), uzp.dataPtr(), ion_lev,
+                    mx_fab, my_fab, mz_fab, np, dt, dinv, xyzmin, lo, q, m);
+            } else if (WarpX::nox == 4){
+                doMassMatrixDepositionShapeNImplicit<4>(
+                    GetPosition, wp.dataPtr(), uxp_n.dataPtr(), uyp_n.dataPtr(), uzp_n.dataPtr(),
+                    uxp.dataPtr(), uyp.dataPtr(), uzp.dataPtr(), ion_lev,
+                    mx_fab, my_fab, mz_fab, np, dt, dinv, xyzmin, lo, q, m);
+            }
+
+#ifndef AMREX_USE_GPU
+            AddLocalCurrent((*mx)[pti], local_jx[thread_num], local_j_rounded[thread_num], tbx, mx->nComp());
+            AddLocalCurrent((*my)[pti], local_jy[thread_num], local_j_rounded[thread_num], tby, my->nComp());
+            AddLocalCurrent((*mz)[pti], local_jz[thread_num], local_j_rounded[thread_num], tbz, mz->nComp());
+#endif
+        }
+#ifdef AMREX_USE_OMP
+        }
+#endif
+    }
+}
+
 /* \brief Charge Deposition for thread thread_num
  * \param pti         Particle iterator
  * \param wp          Array of particle weights
@@ -1365,7 +1791,10 @@ WarpXParticleContainer::DepositTemperature (amrex::MultiFab* temperature, const
 
     // Temporary cell-centered, multi-component MultiFab for storing particles sums
     int const sum_comps = 4;
-    amrex::MultiFab sum_mf(temperature->boxArray(), temperature->DistributionMap(), sum_comps, temperature->nGrowVect());
+    ScratchMultiFab sum_mf_scratch = WarpX::GetInstance().GetScratchPool().Get(
+        temperature->boxArray(), temperature->DistributionMap(), sum_comps, temperature->nGrowVect(),
+        "DepositTemperature");
+    amrex::MultiFab& sum_mf = *sum_mf_scratch;
     sum_mf.setVal(0., 0, sum_comps, sum_mf.nGrowVect());
 
     // Calculate the averages in two steps, first the average velocity <u>, then the
@@ -1565,12 +1994,17 @@ WarpXParticleContainer::GetDebyeLength (int lev)
         "The Debye length can not be calculated for a massless or neutral species.");
 
     std::unique_ptr<amrex::MultiFab> temperature = GetTemperature(lev);
-    std::unique_ptr<amrex::MultiFab> number_density = GetNumberDensity(lev);
 
     amrex::BoxArray const & ba = temperature->boxArray();
     amrex::DistributionMapping const & dm = temperature->DistributionMap();
     int const ncomps = 1;
     int const ng = 0;
+
+    // Same as GetNumberDensity, in a temporary
+    ScratchMultiFab number_density = WarpX::GetInstance().GetScratchPool().Get(
+        ba, dm, ncomps, amrex::IntVect(ng), "GetDebyeLength");
+    number_density->setVal(0., 0, ncomps, number_density->nGrowVect());
+    DepositNumberDensity(number_density.get(), lev);
     auto debye_length = std::make_unique<amrex::MultiFab>(ba, dm, ncomps, ng);
 
     amrex::Real const rmass = (amrex::Real)(mass);
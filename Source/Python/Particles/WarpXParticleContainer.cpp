@@ -7,6 +7,9 @@
 #include "Python/pyWarpX.H"
 
 #include <Particles/WarpXParticleContainer.H>
+#include <Utils/TextMsg.H>
+
+#include <vector>
 
 
 void init_WarpXParIter (py::module& m)
@@ -141,5 +144,24 @@ void init_WarpXParticleContainer (py::module& m)
             [](WarpXParticleContainer& pc, bool flag) { pc.setDoNotPush(flag); },
             py::arg("flag")
         )
+        .def("sort_particles_by_bin",
+            [](WarpXParticleContainer& pc, const std::vector<int>& bin_size)
+            {
+                WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+                    static_cast<int>(bin_size.size()) == AMREX_SPACEDIM,
+                    "sort_particles_by_bin: bin_size must have one entry per dimension");
+                pc.SortParticlesByBin(amrex::IntVect(bin_size.data()));
+            },
+            py::arg("bin_size")
+        )
+        .def("redistribute",
+            [](WarpXParticleContainer& pc) { pc.Redistribute(); },
+            "Redistribute the particles, which invalidates the views of the particle data."
+        )
+        .def_property_readonly("data_generation",
+            &WarpXParticleContainer::DataGeneration,
+            "Counter incremented by each operation that can reallocate, resize or reorder "
+            "the particle tiles, which invalidates the views of the particle data."
+        )
     ;
 }
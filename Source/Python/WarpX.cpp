@@ -32,6 +32,7 @@
 #include <Fluids/WarpXFluidContainer.H>
 #include <Particles/ParticleBoundaryBuffer.H>
 #include <AcceleratorLattice/AcceleratorLattice.H>
+#include <Utils/ScratchMultiFabPool.H>
 #include <Utils/TextMsg.H>
 #include <Utils/WarpXAlgorithmSelection.H>
 #include <Utils/WarpXConst.H>
@@ -66,6 +67,36 @@ void init_WarpX (py::module& m)
     m.def("finalize", &WarpX::Finalize,
         "Close out the WarpX related data");
 
+    py::class_<ScratchMultiFab>(m, "ScratchMultiFab")
+        .def_property_readonly("multifab",
+            [](ScratchMultiFab const & smf){ return smf.get(); },
+            py::return_value_policy::reference_internal,
+            "The temporary MultiFab, or None if it was given back to the pool."
+        )
+        .def("reset", &ScratchMultiFab::reset,
+            "Give the MultiFab back to the pool."
+        )
+    ;
+
+    py::class_<ScratchMultiFabPool>(m, "ScratchMultiFabPool")
+        .def("get",
+            [](ScratchMultiFabPool & pool, amrex::BoxArray const & ba, amrex::DistributionMapping const & dm,
+               int ncomp, amrex::IntVect const & ngrow) {
+                return pool.Get(ba, dm, ncomp, ngrow);
+            },
+            py::arg("ba"), py::arg("dm"), py::arg("ncomp"), py::arg("ngrow"),
+            "Return a temporary MultiFab with the given layout, whose data is not initialized."
+        )
+        .def("clear", &ScratchMultiFabPool::Clear,
+            "Free the cached MultiFabs."
+        )
+        .def_property_readonly("bytes_in_use", &ScratchMultiFabPool::BytesInUse)
+        .def_property_readonly("bytes_cached", &ScratchMultiFabPool::BytesCached)
+        .def_property_readonly("high_water_mark", &ScratchMultiFabPool::HighWaterMark)
+        .def_property_readonly("num_allocations", &ScratchMultiFabPool::NumAllocations)
+        .def_property_readonly("num_reuses", &ScratchMultiFabPool::NumReuses)
+    ;
+
     py::class_<WarpX> warpx(m, "WarpX");
     warpx
         // WarpX is a Singleton Class with a private constructor
@@ -205,6 +236,11 @@ The physical fields in WarpX have the following naming:
             [](WarpX& wx){ return &wx.GetParticleBoundaryBuffer(); },
             py::return_value_policy::reference_internal
         )
+        .def("scratch_multifab_pool",
+            [](WarpX& wx){ return &wx.GetScratchPool(); },
+            py::return_value_policy::reference_internal,
+            "The pool of temporary MultiFabs."
+        )
 
         // Expose functions used to sync the charge density multifab
         // accross tiles and apply appropriate boundary conditions
@@ -236,6 +272,11 @@ The physical fields in WarpX have the following naming:
             py::arg("lev"),
             "Get the current physical time step size on mesh-refinement level ``lev``."
         )
+        .def("get_field_data_generation",
+            [](WarpX const & wx){ return wx.getFieldDataGeneration(); },
+            "Get a counter incremented each time the fields are allocated or reallocated on a new grid layout, "
+            "which invalidates the zero-copy views of the field data."
+        )
 
         .def("set_potential_on_domain_boundary",
             [](WarpX& wx,
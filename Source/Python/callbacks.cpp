@@ -8,12 +8,28 @@
  */
 #include "callbacks.H"
 
+#include "Utils/TextMsg.H"
+
+#include <AMReX_Print.H>
+
+#ifndef _WIN32
+#   include <dlfcn.h>
+#endif
+
 #include <cstdlib>
 #include <exception>
 #include <iostream>
+#include <utility>
 
 
 std::map< std::string, std::function<void()> > warpx_callback_py_map;
+std::map< std::string, std::vector<std::function<void()>> > warpx_callback_native_map;
+
+namespace
+{
+    /** Handles of the loaded plugins, by path as given in warpx.plugins */
+    std::map< std::string, void* > warpx_native_plugins;
+}
 
 void InstallPythonCallback ( const std::string& name, std::function<void()> callback )
 {
@@ -28,6 +44,13 @@ bool IsPythonCallbackInstalled ( const std::string& name )
 // Execute Python callbacks of the type given by the input string
 void ExecutePythonCallback ( const std::string& name )
 {
+    if ( IsNativeCallbackInstalled(name) ) {
+        WARPX_PROFILE("warpx_native_" + name);
+        for (auto const& callback : warpx_callback_native_map[name]) {
+            callback();
+        }
+    }
+
     if ( IsPythonCallbackInstalled(name) ) {
         WARPX_PROFILE("warpx_py_" + name);
         try {
@@ -51,3 +74,63 @@ void ClearPythonCallback ( const std::string& name )
 {
     warpx_callback_py_map.erase(name);
 }
+
+void InstallNativeCallback ( const std::string& name, std::function<void()> callback )
+{
+    warpx_callback_native_map[name].push_back(std::move(callback));
+}
+
+bool IsNativeCallbackInstalled ( const std::string& name )
+{
+    auto const it = warpx_callback_native_map.find(name);
+    return (it != warpx_callback_native_map.end() && !it->second.empty());
+}
+
+bool IsCallbackInstalled ( const std::string& name )
+{
+    return IsNativeCallbackInstalled(name) || IsPythonCallbackInstalled(name);
+}
+
+void ClearNativeCallback ( const std::string& name )
+{
+    warpx_callback_native_map.erase(name);
+}
+
+void LoadNativePlugin ( const std::string& path )
+{
+#ifdef _WIN32
+    WARPX_ABORT_WITH_MESSAGE("Plugin " + path + " cannot be loaded: plugins are not supported on Windows");
+#else
+    // ReadParameters can run more than once, e.g., when re-initializing from Python:
+    // a plugin is only loaded (and its callbacks installed) once
+    if (warpx_native_plugins.count(path) > 0) { return; }
+
+    // The library stays loaded until UnloadNativePlugins, since the installed callbacks point into it
+    void* const handle = dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(handle != nullptr,
+        "Plugin " + path + " could not be loaded: " + std::string(dlerror()));
+
+    using PluginInit = void (*) ();
+    auto const plugin_init = reinterpret_cast<PluginInit>(dlsym(handle, "warpx_plugin_init"));
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(plugin_init != nullptr,
+        "Plugin " + path + " does not define the function extern \"C\" void warpx_plugin_init ()");
+
+    warpx_native_plugins[path] = handle;
+    plugin_init();
+    amrex::Print() << "Loaded plugin " << path << "\n";
+#endif
+}
+
+void UnloadNativePlugins ()
+{
+    // The native callbacks may point into the plugins: remove them first
+    warpx_callback_native_map.clear();
+#ifndef _WIN32
+    for (auto const& [path, handle] : warpx_native_plugins) {
+        if (dlclose(handle) != 0) {
+            amrex::Print() << "Plugin " << path << " could not be unloaded: " << dlerror() << "\n";
+        }
+    }
+#endif
+    warpx_native_plugins.clear();
+}
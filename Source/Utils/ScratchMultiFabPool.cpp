@@ -0,0 +1,179 @@
+/* Copyright 2024 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "ScratchMultiFabPool.H"
+
+#include <AMReX_FArrayBox.H>
+#include <AMReX_MFIter.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace
+{
+    /** Number of bytes allocated on this rank for the data of mf */
+    amrex::Long LocalBytes (amrex::MultiFab const& mf)
+    {
+        amrex::Long bytes = 0;
+        for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            bytes += static_cast<amrex::Long>(mf[mfi].nBytes());
+        }
+        return bytes;
+    }
+}
+
+ScratchMultiFab::ScratchMultiFab (ScratchMultiFabPool* pool, std::unique_ptr<amrex::MultiFab> mf,
+                                  int generation)
+    : m_pool{pool}, m_mf{std::move(mf)}, m_generation{generation}
+{}
+
+ScratchMultiFab::~ScratchMultiFab ()
+{
+    reset();
+}
+
+ScratchMultiFab::ScratchMultiFab (ScratchMultiFab&& other) noexcept
+    : m_pool{other.m_pool}, m_mf{std::move(other.m_mf)}, m_generation{other.m_generation}
+{
+    other.m_pool = nullptr;
+}
+
+ScratchMultiFab&
+ScratchMultiFab::operator= (ScratchMultiFab&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        m_pool = other.m_pool;
+        m_mf = std::move(other.m_mf);
+        m_generation = other.m_generation;
+        other.m_pool = nullptr;
+    }
+    return *this;
+}
+
+void
+ScratchMultiFab::reset ()
+{
+    if (m_pool && m_mf) {
+        m_pool->Return(std::move(m_mf), m_generation);
+    }
+    m_mf.reset();
+    m_pool = nullptr;
+}
+
+ScratchMultiFab
+ScratchMultiFabPool::Get (amrex::BoxArray const& ba, amrex::DistributionMapping const& dm,
+                          int ncomp, amrex::IntVect const& ngrow, std::string const& tag)
+{
+    // the most recently returned MultiFab is reused first
+    auto const match = std::find_if(m_cached.rbegin(), m_cached.rend(),
+        [&] (CachedMultiFab const& cached) {
+            amrex::MultiFab const& mf = *cached.mf;
+            return mf.nComp() == ncomp && mf.nGrowVect() == ngrow &&
+                mf.ixType() == ba.ixType() && mf.boxArray() == ba &&
+                mf.DistributionMap() == dm;
+        });
+
+    std::unique_ptr<amrex::MultiFab> mf;
+    if (match != m_cached.rend()) {
+        mf = std::move(match->mf);
+        const amrex::Long bytes = match->bytes;
+        m_cached.erase(std::next(match).base());
+        m_bytes_cached -= bytes;
+        m_bytes_in_use += bytes;
+        ++m_num_reuses;
+    } else {
+        mf = std::make_unique<amrex::MultiFab>(ba, dm, ncomp, ngrow, amrex::MFInfo().SetTag(tag));
+        m_bytes_in_use += LocalBytes(*mf);
+        ++m_num_allocations;
+    }
+    m_high_water_mark = std::max(m_high_water_mark, m_bytes_in_use + m_bytes_cached);
+
+    return ScratchMultiFab{this, std::move(mf), m_generation};
+}
+
+void
+ScratchMultiFabPool::Return (std::unique_ptr<amrex::MultiFab> mf, int generation)
+{
+    const amrex::Long bytes = LocalBytes(*mf);
+    m_bytes_in_use -= bytes;
+    if (m_enabled && generation == m_generation) {
+        m_bytes_cached += bytes;
+        m_cached.push_back(CachedMultiFab{std::move(mf), bytes, m_step});
+        EnforceMaxBytesCached();
+    }
+}
+
+void
+ScratchMultiFabPool::EnforceMaxBytesCached ()
+{
+    if (m_max_bytes_cached < 0) { return; }
+    auto evicted = m_cached.begin();
+    while (evicted != m_cached.end() && m_bytes_cached > m_max_bytes_cached) {
+        m_bytes_cached -= evicted->bytes;
+        ++evicted;
+    }
+    m_cached.erase(m_cached.begin(), evicted);
+}
+
+void
+ScratchMultiFabPool::AdvanceStep ()
+{
+    ++m_step;
+    if (m_max_age < 0) { return; }
+    // keeps the order of the MultiFabs that are not expired
+    auto const expired = std::stable_partition(m_cached.begin(), m_cached.end(),
+        [&] (CachedMultiFab const& cached) { return m_step - cached.step <= m_max_age; });
+    for (auto it = expired; it != m_cached.end(); ++it) {
+        m_bytes_cached -= it->bytes;
+    }
+    m_cached.erase(expired, m_cached.end());
+}
+
+void
+ScratchMultiFabPool::Clear ()
+{
+    m_cached.clear();
+    m_bytes_cached = 0;
+    ++m_generation;
+}
+
+void
+ScratchMultiFabPool::SetMaxBytesCached (amrex::Long max_bytes)
+{
+    m_max_bytes_cached = max_bytes;
+    EnforceMaxBytesCached();
+}
+
+void
+ScratchMultiFabPool::SetMaxAge (int max_age)
+{
+    m_max_age = max_age;
+}
+
+void
+ScratchMultiFabPool::SetEnabled (bool enabled)
+{
+    m_enabled = enabled;
+    if (!m_enabled) { Clear(); }
+}
+
+void
+ScratchMultiFabPool::PrintStatistics () const
+{
+    amrex::Long high_water_mark = m_high_water_mark;
+    amrex::ParallelDescriptor::ReduceLongMax(high_water_mark);
+    amrex::Long counts[2] = {m_num_allocations, m_num_reuses};
+    amrex::ParallelDescriptor::ReduceLongSum(counts, 2);
+
+    amrex::Print() << "Scratch MultiFab pool: high-water mark "
+                   << static_cast<double>(high_water_mark)/(1024.*1024.)
+                   << " MB (max per rank), " << counts[0] << " allocations, "
+                   << counts[1] << " reuses (total over the ranks)\n";
+}
@@ -92,6 +92,8 @@ namespace
 
         AMREX_ALWAYS_ASSERT(ng[dir] >= std::abs(num_shift));
 
+        // Not taken from the scratch pool: the layout of each shifted MultiFab
+        // is only used once per shift, so that the cached copies would not be reused
         amrex::MultiFab tmpmf(ba, dm, nc, ng);
         amrex::MultiFab::Copy(tmpmf, mf, 0, 0, nc, ng);
 
@@ -367,6 +369,10 @@ WarpX::MoveWindow (const int step, bool move_j)
 
     if (num_shift_base == 0) { return 0; }
 
+    // The fields move across the boxes, which must all be scanned again
+    // by UpdateActiveFieldBoxes
+    m_field_box_state.clear();
+
     // update the problem domain. Note the we only do this on the base level because
     // amrex::Geometry objects share the same, static RealBox.
     for (int i=0; i<AMREX_SPACEDIM; i++) {
@@ -42,6 +42,7 @@
 #include "Fluids/WarpXFluidContainer.H"
 #include "Particles/ParticleBoundaryBuffer.H"
 #include "AcceleratorLattice/AcceleratorLattice.H"
+#include "Python/callbacks.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXAlgorithmSelection.H"
 #include "Utils/WarpXConst.H"
@@ -309,6 +310,7 @@ void
 WarpX::Finalize()
 {
     WarpX::ResetInstance();
+    UnloadNativePlugins();
 }
 
 WarpX::WarpX ()
@@ -374,10 +376,12 @@ WarpX::WarpX ()
     Bfield_dotMask.resize(nlevs_max);
     Afield_dotMask.resize(nlevs_max);
     phi_dotMask.resize(nlevs_max);
+    m_coarse_fine_masks.resize(nlevs_max);
 
     m_eb_update_E.resize(nlevs_max);
     m_eb_update_B.resize(nlevs_max);
     m_eb_reduce_particle_shape.resize(nlevs_max);
+    m_eb_box_type.resize(nlevs_max);
 
     m_flag_info_face.resize(nlevs_max);
     m_flag_ext_face.resize(nlevs_max);
@@ -519,6 +523,23 @@ WarpX::WarpX ()
 
 WarpX::~WarpX ()
 {
+    if (verbose) {
+        m_scratch_pool.PrintStatistics();
+
+        if (mypc) {
+            amrex::Long num_tile_reallocations = mypc->NumTileReallocations();
+            amrex::ParallelDescriptor::ReduceLongSum(
+                num_tile_reallocations, amrex::ParallelDescriptor::IOProcessorNumber());
+            amrex::Print() << "Particle tiles reallocated for new particles: "
+                           << num_tile_reallocations;
+            if (m_num_evolved_steps > 0) {
+                amrex::Print() << " (" << static_cast<double>(num_tile_reallocations)/m_num_evolved_steps
+                               << " per step)";
+            }
+            amrex::Print() << "\n";
+        }
+    }
+
     const int nlevs_max = maxLevel() +1;
     for (int lev = 0; lev < nlevs_max; ++lev) {
         ClearLevel(lev);
@@ -661,6 +682,13 @@ WarpX::ReadParameters ()
 
         utils::parser::queryWithParser(pp_warpx, "cfl", cfl);
         pp_warpx.query("verbose", verbose);
+
+        // Native plugins, which install callbacks in the PIC loop
+        std::vector<std::string> plugins;
+        pp_warpx.queryarr("plugins", plugins);
+        for (auto const& plugin : plugins) {
+            LoadNativePlugin(plugin);
+        }
         utils::parser::queryWithParser(pp_warpx, "regrid_int", regrid_int);
         pp_warpx.query("do_subcycling", m_do_subcycling);
         pp_warpx.query("do_multi_J", do_multi_J);
@@ -671,6 +699,23 @@ WarpX::ReadParameters ()
         }
         pp_warpx.query("use_hybrid_QED", use_hybrid_QED);
         pp_warpx.query("safe_guard_cells", m_safe_guard_cells);
+        pp_warpx.query("fdtd_skip_empty_boxes", m_fdtd_skip_empty_boxes);
+        bool use_scratch_multifab_pool = true;
+        pp_warpx.query("use_scratch_multifab_pool", use_scratch_multifab_pool);
+        m_scratch_pool.SetEnabled(use_scratch_multifab_pool);
+        amrex::Real scratch_multifab_pool_max_mb = 256.;
+        utils::parser::queryWithParser(
+            pp_warpx, "scratch_multifab_pool_max_mb", scratch_multifab_pool_max_mb);
+        m_scratch_pool.SetMaxBytesCached(
+            static_cast<amrex::Long>(scratch_multifab_pool_max_mb*1024.*1024.));
+        int scratch_multifab_pool_max_age = 100;
+        utils::parser::queryWithParser(
+            pp_warpx, "scratch_multifab_pool_max_age", scratch_multifab_pool_max_age);
+        m_scratch_pool.SetMaxAge(scratch_multifab_pool_max_age);
+#ifdef WARPX_DIM_RZ
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!m_fdtd_skip_empty_boxes,
+            "warpx.fdtd_skip_empty_boxes is not implemented in RZ geometry");
+#endif
         std::vector<std::string> override_sync_intervals_string_vec = {"1"};
         pp_warpx.queryarr("override_sync_intervals", override_sync_intervals_string_vec);
         override_sync_intervals =
@@ -2036,6 +2081,7 @@ void
 WarpX::MakeNewLevelFromScratch (int lev, Real time, const BoxArray& new_grids,
                                 const DistributionMapping& new_dmap)
 {
+    ++m_field_data_generation;
     AllocLevelData(lev, new_grids, new_dmap);
     InitLevelData(lev, time);
 }
@@ -2051,6 +2097,9 @@ WarpX::MakeNewLevelFromCoarse (int /*lev*/, amrex::Real /*time*/, const amrex::B
 void
 WarpX::ClearLevel (int lev)
 {
+    // The cached temporaries may be defined on the grids of this level
+    m_scratch_pool.Clear();
+    ++m_field_data_generation;
     m_fields.clear_level(lev);
 
     for (int i = 0; i < 3; ++i) {
@@ -2060,6 +2109,8 @@ WarpX::ClearLevel (int lev)
     }
 
     phi_dotMask[lev].reset();
+    m_coarse_fine_masks[lev].clear();
+    m_eb_box_type[lev].reset();
 
 #ifdef WARPX_USE_FFT
     if (WarpX::electromagnetic_solver_id == ElectromagneticSolverAlgo::PSATD) {
@@ -2141,6 +2192,19 @@ WarpX::AllocLevelData (int lev, const BoxArray& ba, const DistributionMapping& d
         n_field_gather_buffer = n_current_deposition_buffer + 1;
     }
 
+    // With deep halos, the hybrid-PIC solver calculates the fields in the guard
+    // cells during several substeps, from the ion current and charge density in
+    // these guard cells, which thus need enough guard cells. Without deep halos,
+    // the guard cells (and thus the current deposition buffers and the exchanges
+    // of J and rho) are not widened.
+    if (electromagnetic_solver_id == ElectromagneticSolverAlgo::HybridPIC
+        && m_hybrid_pic_model->m_use_deep_halo) {
+        const IntVect ng_deep_halo = m_hybrid_pic_model->InitDeepHalo(maxGridSize(lev));
+        guard_cells.ng_alloc_EB.max(ng_deep_halo);
+        guard_cells.ng_alloc_J.max(ng_deep_halo);
+        guard_cells.ng_alloc_Rho.max(ng_deep_halo);
+    }
+
     AllocLevelMFs(lev, ba, dm, guard_cells.ng_alloc_EB, guard_cells.ng_alloc_J,
                   guard_cells.ng_alloc_Rho, guard_cells.ng_alloc_F, guard_cells.ng_alloc_G, aux_is_nodal);
 
@@ -3133,6 +3197,18 @@ WarpX::getCosts (int lev)
     }
 }
 
+amrex::LayoutData<int>*
+WarpX::getActiveFieldBoxes (int lev)
+{
+    if (m_instance && lev < static_cast<int>(m_instance->m_active_field_boxes.size()))
+    {
+        return m_instance->m_active_field_boxes[lev].get();
+    } else
+    {
+        return nullptr;
+    }
+}
+
 void
 WarpX::setLoadBalanceEfficiency (const int lev, const amrex::Real efficiency)
 {
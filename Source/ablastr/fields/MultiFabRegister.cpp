@@ -7,7 +7,12 @@
  */
 #include "MultiFabRegister.H"
 
+#include <AMReX_BoxList.H>
+#include <AMReX_FArrayBox.H>
 #include <AMReX_MakeType.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Vector.H>
 
 #include <array>
 #include <memory>
@@ -18,6 +23,100 @@
 #include <vector>
 
 
+namespace
+{
+    /** Whether AMReX allocates the data of all the FABs of a MultiFab in a single
+     * chunk (amrex.mf.alloc_single_chunk). The FABs then do not own their data,
+     * which cannot be handed over to another MultiFab.
+     */
+    bool
+    alloc_single_chunk ()
+    {
+        bool single_chunk = false;
+        amrex::ParmParse const pp_mf("amrex.mf");
+        pp_mf.query("alloc_single_chunk", single_chunk);
+        return single_chunk;
+    }
+
+    /** Remake a MultiFab with a new distribution mapping of the same BoxArray.
+     *
+     * For the boxes that stay on their rank, the new MultiFab takes the FABs of the
+     * old one, in exchange for its own newly allocated FABs, so that their data is
+     * not copied. Only the boxes that change rank are sent, if redistribute is true,
+     * so that the communication scales with the number of boxes that move.
+     *
+     * Since the exchanged FABs have the same size, the memory usage recorded for the
+     * tag of the MultiFab stays consistent when the old MultiFab is freed. This
+     * requires FABs that own their data, i.e. not amrex.mf.alloc_single_chunk = 1.
+     *
+     * @param mf the MultiFab to remake, its FABs are exchanged
+     * @param new_dm new distribution mapping
+     * @param redistribute copy the data of the boxes that change rank
+     * @return the remade MultiFab
+     */
+    amrex::MultiFab
+    remake_box_local (
+        amrex::MultiFab & mf,
+        amrex::DistributionMapping const & new_dm,
+        bool redistribute
+    )
+    {
+        amrex::BoxArray const & ba = mf.boxArray();
+        amrex::DistributionMapping const & old_dm = mf.DistributionMap();
+        int const ncomp = mf.nComp();
+        amrex::IntVect const ng = mf.nGrowVect();
+        int const myproc = amrex::ParallelDescriptor::MyProc();
+
+        const auto tag = amrex::MFInfo().SetTag(mf.tags()[0]);
+        amrex::MultiFab new_mf(ba, new_dm, ncomp, ng, tag);
+
+        // boxes that stay on this rank: exchange the FABs
+        for (int const i : new_mf.IndexArray()) {
+            if (old_dm[i] == myproc) {
+                std::unique_ptr<amrex::FArrayBox> old_fab(mf.release(i));
+                std::unique_ptr<amrex::FArrayBox> new_fab(new_mf.release(i));
+                new_mf.setFab(i, std::move(old_fab));
+                mf.setFab(i, std::move(new_fab));
+            }
+        }
+
+        if (!redistribute) { return new_mf; }
+
+        // boxes that change rank: one communication restricted to these boxes,
+        // between aliases of the FABs of the old and new MultiFabs
+        amrex::BoxList moved_bl(ba.ixType());
+        amrex::Vector<int> moved_index, moved_old_pmap, moved_new_pmap;
+        for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+            if (old_dm[i] != new_dm[i]) {
+                moved_bl.push_back(ba[i]);
+                moved_index.push_back(i);
+                moved_old_pmap.push_back(old_dm[i]);
+                moved_new_pmap.push_back(new_dm[i]);
+            }
+        }
+        if (moved_index.empty()) { return new_mf; }
+
+        amrex::BoxArray const moved_ba(std::move(moved_bl));
+        amrex::MultiFab src(moved_ba, amrex::DistributionMapping(std::move(moved_old_pmap)),
+                            ncomp, ng, amrex::MFInfo().SetAlloc(false));
+        amrex::MultiFab dst(moved_ba, amrex::DistributionMapping(std::move(moved_new_pmap)),
+                            ncomp, ng, amrex::MFInfo().SetAlloc(false));
+        for (int j = 0; j < static_cast<int>(moved_ba.size()); ++j) {
+            if (src.DistributionMap()[j] == myproc) {
+                src.setFab(j, std::make_unique<amrex::FArrayBox>(
+                    mf[moved_index[j]], amrex::make_alias, 0, ncomp));
+            }
+            if (dst.DistributionMap()[j] == myproc) {
+                dst.setFab(j, std::make_unique<amrex::FArrayBox>(
+                    new_mf[moved_index[j]], amrex::make_alias, 0, ncomp));
+            }
+        }
+        dst.Redistribute(src, 0, 0, ncomp, ng);
+
+        return new_mf;
+    }
+}
+
 namespace ablastr::fields
 {
     amrex::MultiFab*
@@ -247,6 +346,9 @@ namespace ablastr::fields
         amrex::DistributionMapping const & new_dm
     )
     {
+        // The FABs can only be handed over to the new MultiFabs if they own their data
+        bool const single_chunk = alloc_single_chunk();
+
         // Owning MultiFabs
         for (auto & element : m_mf_register )
         {
@@ -259,15 +361,22 @@ namespace ablastr::fields
 
             // remake MultiFab with new distribution map
             if (mf_owner.m_level == level && !mf_owner.is_alias()) {
-                const amrex::MultiFab & mf = mf_owner.m_mf;
-                amrex::IntVect const & ng = mf.nGrowVect();
-                const auto tag = amrex::MFInfo().SetTag(mf.tags()[0]);
-                amrex::MultiFab new_mf(mf.boxArray(), new_dm, mf.nComp(), ng, tag);
-
                 // copy data to new MultiFab: Only done for persistent data like E and B field, not for
                 // temporary things like currents, etc.
-                if (mf_owner.m_redistribute_on_remake) {
-                    new_mf.Redistribute(mf, 0, 0, mf.nComp(), ng);
+                amrex::MultiFab new_mf;
+                if (single_chunk) {
+                    const amrex::MultiFab & mf = mf_owner.m_mf;
+                    amrex::IntVect const & ng = mf.nGrowVect();
+                    const auto tag = amrex::MFInfo().SetTag(mf.tags()[0]);
+                    new_mf.define(mf.boxArray(), new_dm, mf.nComp(), ng, tag);
+                    if (mf_owner.m_redistribute_on_remake) {
+                        new_mf.Redistribute(mf, 0, 0, mf.nComp(), ng);
+                    }
+                } else {
+                    // keep the data of the boxes that stay on their rank, and only
+                    // send the boxes that change rank
+                    new_mf = remake_box_local(
+                        mf_owner.m_mf, new_dm, mf_owner.m_redistribute_on_remake);
                 }
 
                 // replace old MultiFab with new one, deallocate old one
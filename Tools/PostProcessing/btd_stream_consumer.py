@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 The WarpX Community
+#
+# This file is part of WarpX.
+#
+# License: BSD-3-Clause-LBNL
+
+"""
+Consumer for back-transformed diagnostics (BTD) streamed by WarpX.
+
+When a BTD uses ``<diag_name>.openpmd_backend = sst`` (or
+``<diag_name>.adios2_engine.type = sst``), WarpX sends every flushed buffer of
+lab-frame slices as its own step of an ADIOS2 stream, tagged with the
+attributes ``btdSnapshot``, ``btdBuffer``, ``btdNumBuffers`` and
+``btdLastFlush``. This script reads the stream as it is produced and
+assembles the lab-frame snapshots into a regular openPMD series.
+
+Fields are written chunk by chunk at their position in the full snapshot.
+Particles of a snapshot are gathered in memory and written once the last
+buffer of that snapshot has arrived.
+
+Usage (start it next to the WarpX run, on the same or on another node):
+
+    python btd_stream_consumer.py diags/btd/openpmd.sst diags/btd_lab/openpmd_%T.bp
+"""
+
+import argparse
+from collections import defaultdict
+
+import numpy as np
+import openpmd_api as io
+
+
+def get_attributes(src, skip=()):
+    """Return all openPMD attributes of src, except those in skip, as a dict."""
+    return {
+        name: src.get_attribute(name) for name in src.attributes if name not in skip
+    }
+
+
+def copy_attributes(src, dst, skip=()):
+    """Copy all openPMD attributes of src to dst, except those in skip."""
+    for name, value in get_attributes(src, skip).items():
+        dst.set_attribute(name, value)
+
+
+def consume(stream_path, output_path, verbose=True):
+    series_in = io.Series(stream_path, io.Access.read_linear)
+    series_out = io.Series(output_path, io.Access.create)
+    series_out.set_software("WarpX BTD stream consumer")
+
+    # particle data of the snapshots that are not complete yet:
+    # pending_particles[snapshot][species][(record, component)] = list of arrays
+    pending_particles = defaultdict(lambda: defaultdict(lambda: defaultdict(list)))
+    # constant particle records: constants[snapshot][species][(record, component)] = (dtype, value, attrs)
+    constants = defaultdict(lambda: defaultdict(dict))
+    # attributes of the particle records: record_attrs[snapshot][species][record] = attrs
+    record_attrs = defaultdict(lambda: defaultdict(dict))
+    # fields for which the full snapshot dataset was already declared
+    declared_fields = set()
+
+    for it_in in series_in.read_iterations():
+        snapshot = int(it_in.get_attribute("btdSnapshot"))
+        buffer_id = int(it_in.get_attribute("btdBuffer"))
+        num_buffers = int(it_in.get_attribute("btdNumBuffers"))
+        is_last = bool(it_in.get_attribute("btdLastFlush"))
+
+        it_out = series_out.iterations[snapshot]
+        it_out.time = it_in.time
+        it_out.time_unit_SI = it_in.time_unit_SI
+
+        # queue loads of all fields chunks of this buffer
+        loaded_fields = []
+        for mesh_name, mesh_in in it_in.meshes.items():
+            mesh_out = it_out.meshes[mesh_name]
+            copy_attributes(mesh_in, mesh_out)
+            for comp_name, rc_in in mesh_in.items():
+                rc_out = mesh_out[comp_name]
+                key = (snapshot, mesh_name, comp_name)
+                if key not in declared_fields:
+                    # the stream declares the extent of the full lab-frame snapshot
+                    rc_out.reset_dataset(io.Dataset(rc_in.dtype, rc_in.shape))
+                    copy_attributes(rc_in, rc_out)
+                    declared_fields.add(key)
+                for chunk in rc_in.available_chunks():
+                    data = rc_in.load_chunk(chunk.offset, chunk.extent)
+                    loaded_fields.append((rc_out, data, chunk.offset, chunk.extent))
+
+        # queue loads of all particles of this buffer
+        loaded_particles = []
+        for species_name, species_in in it_in.particles.items():
+            for record_name, record_in in species_in.items():
+                record_attrs[snapshot][species_name][record_name] = get_attributes(
+                    record_in
+                )
+                for comp_name, rc_in in record_in.items():
+                    key = (record_name, comp_name)
+                    if rc_in.constant:
+                        constants[snapshot][species_name][key] = (
+                            rc_in.dtype,
+                            rc_in.get_attribute("value"),
+                            get_attributes(rc_in, skip=("value", "shape")),
+                        )
+                        continue
+                    if rc_in.shape[0] == 0:
+                        continue
+                    data = rc_in.load_chunk()
+                    loaded_particles.append((species_name, key, data))
+
+        # ends the step of the stream: all loads above are now done
+        it_in.close()
+
+        for rc_out, data, offset, extent in loaded_fields:
+            rc_out.store_chunk(data, offset, extent)
+
+        for species_name, key, data in loaded_particles:
+            pending_particles[snapshot][species_name][key].append(data)
+
+        if is_last:
+            write_particles(
+                it_out,
+                pending_particles.pop(snapshot, {}),
+                constants.pop(snapshot, {}),
+                record_attrs.pop(snapshot, {}),
+            )
+            it_out.close()
+        else:
+            series_out.flush()
+
+        if verbose:
+            print(
+                f"snapshot {snapshot}: buffer {buffer_id + 1} of {num_buffers}"
+                + (" (complete)" if is_last else "")
+            )
+
+    series_out.close()
+
+
+def write_particles(it_out, species_data, species_constants, species_record_attrs):
+    """Write the gathered particles of a complete snapshot."""
+    for species_name in set(species_data) | set(species_constants):
+        species_out = it_out.particles[species_name]
+        for record_name, attrs in species_record_attrs.get(species_name, {}).items():
+            for name, value in attrs.items():
+                species_out[record_name].set_attribute(name, value)
+        arrays = species_data.get(species_name, {})
+        num_particles = 0
+        for key, chunks in arrays.items():
+            record_name, comp_name = key
+            data = np.concatenate(chunks)
+            num_particles = data.shape[0]
+            rc_out = species_out[record_name][comp_name]
+            rc_out.reset_dataset(io.Dataset(data.dtype, data.shape))
+            rc_out.store_chunk(data)
+        for key, (dtype, value, attrs) in species_constants.get(species_name, {}).items():
+            record_name, comp_name = key
+            rc_out = species_out[record_name][comp_name]
+            rc_out.reset_dataset(io.Dataset(dtype, [num_particles]))
+            rc_out.make_constant(value)
+            for name, attr in attrs.items():
+                rc_out.set_attribute(name, attr)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Assemble lab-frame snapshots from a streamed WarpX BTD"
+    )
+    parser.add_argument(
+        "stream", help="stream written by WarpX, e.g. diags/btd/openpmd.sst"
+    )
+    parser.add_argument(
+        "output", help="openPMD output series, e.g. diags/btd_lab/openpmd_%%T.bp"
+    )
+    parser.add_argument("--quiet", action="store_true", help="do not print progress")
+    args = parser.parse_args()
+
+    consume(args.stream, args.output, verbose=not args.quiet)